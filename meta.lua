@@ -507,6 +507,15 @@ function ImGui.BeginGroup() end
 ---on whole group, etc.)
 function ImGui.EndGroup() end
 
+---run fn inside a group only when the space it took last frame is visible. When it is scrolled
+---out of view, only reserve that height with a Dummy and skip fn. The height is remembered per
+---id in the window's state storage, estimatedHeight is used until fn first runs.
+---@param id string
+---@param estimatedHeight number
+---@param fn function
+---@return boolean ran
+function ImGui.LazyRegion(id, estimatedHeight, fn) end
+
 ---vertically align upcoming text baseline to FramePadding.y so that it will align 
 ---properly to regularly framed items (call if you have text on a line before a framed item)
 function ImGui.AlignTextToFramePadding() end
@@ -778,8 +787,53 @@ function ImGui.DragInt3(label, value, speed, min, max, format, flags) end
 function ImGui.DragInt4(label, value, speed, min, max, format, flags) end
 
 --!WARNING! DragIntRange2 is not supported
---!WARNING! DragScalar is not supported
---!WARNING! DragScalarN is not supported
+---Typed array the Scalar widgets edit in place. Created from Lua with ImGuiScalarBuffer.new(dataType, count),
+---or handed to Lua by the host as a view over its own memory. Indices are 1-based. new errors when dataType is not an ImGuiDataType.
+---@class ImGuiScalarBuffer
+---@field new fun(dataType: ImGuiDataType, count: integer): ImGuiScalarBuffer
+local ImGuiScalarBuffer = {}
+
+---@param index integer
+---@return integer|number value an integer for the integer data types, so 64-bit values keep their precision
+function ImGuiScalarBuffer:Get(index) end
+
+---@param index integer
+---@param value integer|number converted to the buffer's data type, saturated to the range of an integer type (NaN becomes 0)
+function ImGuiScalarBuffer:Set(index, value) end
+
+---@return ImGuiDataType
+function ImGuiScalarBuffer:GetType() end
+
+---@return integer
+function ImGuiScalarBuffer:GetCount() end
+
+---@return integer stride distance in bytes between elements
+function ImGuiScalarBuffer:GetStride() end
+
+---Drag one element of a buffer, edited in place
+---@param label string
+---@param buffer ImGuiScalarBuffer
+---@param index integer? 1 by default
+---@param speed number?
+---@param min number?
+---@param max number?
+---@param format string?
+---@param flags ImGuiSliderFlags?
+---@return boolean changed
+function ImGui.DragScalar(label, buffer, index, speed, min, max, format, flags) end
+
+---Drag components elements of a buffer from first, edited in place
+---@param label string
+---@param buffer ImGuiScalarBuffer
+---@param first integer? 1 by default
+---@param components integer? the whole buffer by default
+---@param speed number?
+---@param min number?
+---@param max number?
+---@param format string?
+---@param flags ImGuiSliderFlags?
+---@return boolean changed
+function ImGui.DragScalarN(label, buffer, first, components, speed, min, max, format, flags) end
 
 ---Regular slider float values. Ctrl+Click will allow text input
 ---@param label string
@@ -870,8 +924,28 @@ function ImGui.SliderInt3(label, value, min, max, format, flags) end
 ---@return integer[] value, boolean clicked
 function ImGui.SliderInt4(label, value, min, max, format, flags) end
 
---!WARNING! SliderScalar is nott implemented
---!WARNING! SliderScalarN is nott implemented
+---Slider over one element of a buffer, edited in place
+---@param label string
+---@param buffer ImGuiScalarBuffer
+---@param index integer
+---@param min number
+---@param max number
+---@param format string?
+---@param flags ImGuiSliderFlags?
+---@return boolean changed
+function ImGui.SliderScalar(label, buffer, index, min, max, format, flags) end
+
+---Sliders over components elements of a buffer from first, edited in place
+---@param label string
+---@param buffer ImGuiScalarBuffer
+---@param first integer
+---@param components integer
+---@param min number
+---@param max number
+---@param format string?
+---@param flags ImGuiSliderFlags?
+---@return boolean changed
+function ImGui.SliderScalarN(label, buffer, first, components, min, max, format, flags) end
 
 ---VSliderFloat
 ---@param label string
@@ -897,7 +971,18 @@ function ImGui.VSliderFloat(label, width, height, value, min, max, format, flags
 ---@return integer value, boolean clicked
 function ImGui.VSliderInt(label, width, height, value, min, max, format, flags) end
 
---!WARNING! VSliderScalar is nott implemented
+---VSliderScalar
+---@param label string
+---@param width number
+---@param height number
+---@param buffer ImGuiScalarBuffer
+---@param index integer
+---@param min number
+---@param max number
+---@param format string?
+---@param flags ImGuiSliderFlags?
+---@return boolean changed
+function ImGui.VSliderScalar(label, width, height, buffer, index, min, max, format, flags) end
 
 ---Text Input with Keyboard
 ---@param label string
@@ -1003,6 +1088,29 @@ function ImGui.InputInt4(label, values, flags) end
 ---@return number value, boolean clicked
 function ImGui.InputDouble(label, value, step, step_fast, format, flags) end
 
+---Input for one element of a buffer, edited in place
+---@param label string
+---@param buffer ImGuiScalarBuffer
+---@param index integer? 1 by default
+---@param step number? shows the -/+ buttons when given
+---@param step_fast number?
+---@param format string?
+---@param flags ImGuiInputTextFlags?
+---@return boolean changed
+function ImGui.InputScalar(label, buffer, index, step, step_fast, format, flags) end
+
+---Inputs for components elements of a buffer from first, edited in place
+---@param label string
+---@param buffer ImGuiScalarBuffer
+---@param first integer? 1 by default
+---@param components integer? the whole buffer by default
+---@param step number? shows the -/+ buttons when given
+---@param step_fast number?
+---@param format string?
+---@param flags ImGuiInputTextFlags?
+---@return boolean changed
+function ImGui.InputScalarN(label, buffer, first, components, step, step_fast, format, flags) end
+
 ---Color picker
 ---@param label string
 ---@param col number[] len=3
@@ -1720,6 +1828,364 @@ function ImGui.GetClipboardText() end
 ---@param text string
 function ImGui.SetClipboardText(text) end
 
+--[[-----------------------------------------------------------------------------------------------
+    GC Scheduler (only available when built with SOL_IMGUI_ENABLE_GC_SCHEDULER)
+-------------------------------------------------------------------------------------------------]]
+
+---@class ImGuiGCStats
+---@field stepMs number time spent in lua_gc(LUA_GCSTEP) during the last frame
+---@field collectedBytes integer heap shrink caused by those steps
+---@field heapBytes integer heap size after the steps
+---@field steps integer number of LUA_GCSTEP calls
+---@field cycleCompleted boolean a full collection cycle finished during the last frame
+
+---Get the collector statistics of the last frame.
+---@return ImGuiGCStats? stats nil if no GCScheduler is attached to this state
+function ImGui.GetGCStats() end
+
+---Set the per-frame time budget of the attached GCScheduler.
+---@param budgetMs number
+function ImGui.SetGCBudget(budgetMs) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Allocation Tracking (only available when built with SOL_IMGUI_ENABLE_ALLOC_TRACKING)
+-------------------------------------------------------------------------------------------------]]
+
+---@class ImGuiAllocEntry
+---@field bytes integer bytes allocated during the last frame
+---@field count integer number of allocations during the last frame
+
+---@class ImGuiAllocStats : ImGuiAllocEntry
+---@field windows table<string, ImGuiAllocEntry> per window, "<none>" outside of any window
+---@field bindings table<string, ImGuiAllocEntry> per ImGui function, "<lua>" for plain Lua code
+
+---Get the Lua allocations of the last frame, attributed to windows and bindings.
+---@return ImGuiAllocStats? stats nil if no AllocTracker is attached to this state
+function ImGui.GetAllocStats() end
+
+--[[-----------------------------------------------------------------------------------------------
+    Scope Timing (only available when built with SOL_IMGUI_ENABLE_SCOPE_TIMING)
+-------------------------------------------------------------------------------------------------]]
+
+---@class ImGuiScopeTiming
+---@field name string window or scope name
+---@field kind "window"|"scope"
+---@field lastMs number inclusive time during the last frame it ran in
+---@field meanMs number
+---@field p99Ms number
+---@field maxMs number
+---@field samples integer number of frames the statistics are computed over
+
+---Start timing a user-defined scope. Must be closed with EndTimingScope().
+---@param name string
+function ImGui.BeginTimingScope(name) end
+
+---Stop timing the innermost scope opened with BeginTimingScope().
+function ImGui.EndTimingScope() end
+
+---Get the timing statistics of every window and user scope, most expensive (by mean) first.
+---@return ImGuiScopeTiming[]
+function ImGui.GetScopeTimings() end
+
+---Show the overlay ranking windows and user scopes by cost.
+---@param open boolean? shows a close button when provided
+---@return boolean? open
+function ImGui.ShowScopeTimingsWindow(open) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Binding Statistics (only available when built with SOL_IMGUI_ENABLE_BINDING_STATS)
+-------------------------------------------------------------------------------------------------]]
+
+---@class ImGuiBindingStats
+---@field name string ImGui function name
+---@field calls integer
+---@field strings integer string arguments converted
+---@field stringBytes integer
+---@field tablesRead integer table arguments
+---@field tableElements integer array length of those tables
+---@field tablesCreated integer tables returned
+
+---Get the per-binding call counts and conversion costs of the last frame, most called first.
+---@param topN integer? limit the number of entries returned
+---@return ImGuiBindingStats[]
+function ImGui.GetBindingStats(topN) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Sampling Profiler (only available when built with SOL_IMGUI_ENABLE_SAMPLING_PROFILER)
+-------------------------------------------------------------------------------------------------]]
+
+---Show the flame graph of the SamplingProfiler attached to this state.
+---@param open boolean? shows a close button when provided
+---@return boolean? open
+function ImGui.ShowFlameGraphWindow(open) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Trace Zones (only available when built with SOL_IMGUI_ENABLE_TRACE_ZONES)
+-------------------------------------------------------------------------------------------------]]
+
+---Open a zone on the trace timeline. Must be closed with ProfileZoneEnd().
+---@param name string
+function ImGui.ProfileZoneBegin(name) end
+
+---Close the innermost zone opened with ProfileZoneBegin().
+function ImGui.ProfileZoneEnd() end
+
+--[[-----------------------------------------------------------------------------------------------
+    Draw Cost (only available when built with SOL_IMGUI_ENABLE_DRAW_COST)
+-------------------------------------------------------------------------------------------------]]
+
+---@class ImGuiDrawCost
+---@field vertices integer
+---@field indices integer
+---@field commands integer
+---@field textureSwitches integer
+---@field overBudget boolean
+
+---@class ImGuiDrawStats
+---@field windows table<string, ImGuiDrawCost>
+---@field scripts table<string, ImGuiDrawCost> "<none>" when the host did not name the script
+
+---Get the geometry emitted during the last frame per window and per script.
+---@return ImGuiDrawStats
+function ImGui.GetDrawStats() end
+
+---Set the draw budget of a window. A limit of 0 means unlimited.
+---@param window string
+---@param vertices integer
+---@param indices integer
+---@param commands integer
+function ImGui.SetDrawBudget(window, vertices, indices, commands) end
+
+--[[-----------------------------------------------------------------------------------------------
+    LuaJIT FFI (only available when built with SOL_IMGUI_ENABLE_FFI)
+-------------------------------------------------------------------------------------------------]]
+
+---C declarations of the sol_ImGui_* functions exported for LuaJIT's FFI, to pass to ffi.cdef.
+---@return string
+function ImGui.GetFFIDeclarations() end
+
+--[[-----------------------------------------------------------------------------------------------
+    Message Queue (only available when built with SOL_IMGUI_ENABLE_MESSAGE_QUEUE)
+-------------------------------------------------------------------------------------------------]]
+
+---A queue the host's threads post numbers and short strings into. The host hands it to Lua, e.g. as a global.
+---@class ImGuiMessageQueue
+local ImGuiMessageQueue = {}
+
+---Call callback(channel, value) for each queued message, oldest first.
+---@param callback fun(channel: integer, value: number|integer|string)
+---@param limit? integer at most this many messages, all of them by default
+---@return integer drained
+function ImGuiMessageQueue:Drain(callback, limit) end
+
+---Append each queued value to the array tables[channel], creating it when missing.
+---@param tables table<integer, any[]>
+---@param limit? integer at most this many messages, all of them by default
+---@return integer drained
+function ImGuiMessageQueue:DrainInto(tables, limit) end
+
+---Number of messages producers could not post because the queue was full or they were too long.
+---@return integer
+function ImGuiMessageQueue:GetDroppedCount() end
+
+--[[-----------------------------------------------------------------------------------------------
+    Task Scheduler (only available when built with SOL_IMGUI_ENABLE_TASK_SCHEDULER)
+-------------------------------------------------------------------------------------------------]]
+
+---@alias ImGuiTaskStatus "running"|"done"|"failed"|"cancelled"|"expired"
+
+---@class ImGuiTaskStats
+---@field runMs number time spent resuming tasks during the last frame
+---@field resumes integer number of times a task was resumed
+---@field running integer tasks still unfinished after the last frame
+
+---Run fn as a coroutine in the idle part of the following frames, a slice at a time.
+---@param fn function yields with ImGui.Yield()
+---@param priority? integer higher priorities run first, 0 by default
+---@param deadlineMs? number stop the task and report it as expired if it is still running after this long
+---@return integer id
+function ImGui.StartTask(fn, priority, deadlineMs) end
+
+---Stop a task at its next yield.
+---@param id integer
+---@return boolean cancelled false if the task is not running
+function ImGui.CancelTask(id) end
+
+---Final states are reported once, the id is forgotten afterwards.
+---@param id integer
+---@return ImGuiTaskStatus? status nil for ids that were never started or already reported finished
+---@return string? error the error and traceback of a failed task
+function ImGui.GetTaskStatus(id) end
+
+---Inside a task: true once this frame's budget is spent, time to call ImGui.Yield().
+---@return boolean
+function ImGui.ShouldYield() end
+
+---Hand the rest of the frame back, the task resumes from here in a later slice. Same as coroutine.yield.
+function ImGui.Yield() end
+
+---@return ImGuiTaskStats? stats nil if no TaskScheduler is attached to this state
+function ImGui.GetTaskStats() end
+
+--[[-----------------------------------------------------------------------------------------------
+    Retained Widgets (only available when built with SOL_IMGUI_ENABLE_RETAINED)
+-------------------------------------------------------------------------------------------------]]
+
+---A window laid out once from Lua and submitted by the host every frame, without running Lua.
+---Value widgets edit table[key] and call onChange(value) after the window's End, only when the user changed it.
+---Builders return a handle to the widget, for SetLabel.
+---@class ImGuiRetainedWindow
+local ImGuiRetainedWindow = {}
+
+---@param text string
+---@return integer handle
+function ImGuiRetainedWindow:Text(text) end
+
+---@return integer handle
+function ImGuiRetainedWindow:Separator() end
+
+---@return integer handle
+function ImGuiRetainedWindow:SameLine() end
+
+---@param label string
+---@param onClick function
+---@return integer handle
+function ImGuiRetainedWindow:Button(label, onClick) end
+
+---@param label string
+---@param table table
+---@param key any
+---@param onChange? fun(value: boolean)
+---@return integer handle
+function ImGuiRetainedWindow:Checkbox(label, table, key, onChange) end
+
+---@param label string
+---@param table table
+---@param key any
+---@param min number
+---@param max number
+---@param onChange? fun(value: number)
+---@return integer handle
+function ImGuiRetainedWindow:SliderFloat(label, table, key, min, max, onChange) end
+
+---@param label string
+---@param table table
+---@param key any
+---@param min integer
+---@param max integer
+---@param onChange? fun(value: integer)
+---@return integer handle
+function ImGuiRetainedWindow:SliderInt(label, table, key, min, max, onChange) end
+
+---@param label string
+---@param table table
+---@param key any
+---@param speed number
+---@param min number
+---@param max number
+---@param onChange? fun(value: number)
+---@return integer handle
+function ImGuiRetainedWindow:DragFloat(label, table, key, speed, min, max, onChange) end
+
+---@param label string
+---@param table table
+---@param key any
+---@param onChange? fun(value: string)
+---@return integer handle
+function ImGuiRetainedWindow:InputText(label, table, key, onChange) end
+
+---Widgets added until the matching TreePop are only shown while the node is open.
+---@param label string
+---@return integer handle
+function ImGuiRetainedWindow:TreeNode(label) end
+
+---@return integer handle
+function ImGuiRetainedWindow:TreePop() end
+
+---Change the text of a Text widget, or the label of any other widget.
+---@param handle integer
+---@param label string
+function ImGuiRetainedWindow:SetLabel(handle, label) end
+
+---Re-read the table fields the widgets edit, after Lua changed them.
+function ImGuiRetainedWindow:Refresh() end
+
+---Remove every widget.
+function ImGuiRetainedWindow:Clear() end
+
+---@param visible boolean
+function ImGuiRetainedWindow:SetVisible(visible) end
+
+---@return boolean
+function ImGuiRetainedWindow:IsVisible() end
+
+---@param name string
+---@param flags? ImGuiWindowFlags
+---@return ImGuiRetainedWindow
+function ImGui.CreateRetainedWindow(name, flags) end
+
+---Stop rendering the window. Calling its methods afterwards raises an error.
+---@param window ImGuiRetainedWindow
+function ImGui.DestroyRetainedWindow(window) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Property Grid (only available when built with SOL_IMGUI_ENABLE_PROPERTY_GRID)
+-------------------------------------------------------------------------------------------------]]
+
+---@class ImGuiPropertySpec
+---@field name string field of the values table
+---@field label? string shown in the first column, name by default
+---@field type? "float"|"int"|"bool"|"string"|"combo"|"text" "float" by default, "text" is read-only
+---@field widget? "drag"|"slider" for float and int, "drag" by default
+---@field speed? number drag speed
+---@field min? number
+---@field max? number
+---@field format? string one printf conversion matching the type, %d-like for int and %f-like for float and text
+---@field items? string[] combo items, the value is the 0-based index
+
+---Validated field descriptions for ImGui.PropertyGrid.
+---@class ImGuiPropertySpecs
+local ImGuiPropertySpecs = {}
+
+---@return integer
+function ImGuiPropertySpecs:GetCount() end
+
+---Validate the specs once, raising an error that names the first bad spec.
+---@param specs ImGuiPropertySpec[]
+---@return ImGuiPropertySpecs
+function ImGui.CreatePropertySpecs(specs) end
+
+---Render one row per spec, editing values[spec.name]. Only visible rows are read, only changed fields are written.
+---@param id string
+---@param specs ImGuiPropertySpecs
+---@param values table
+---@param height? number scroll inside this many pixels instead of growing with the fields
+---@return integer changed number of fields the user changed
+function ImGui.PropertyGrid(id, specs, values, height) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Reflection Inspector (only available when built with SOL_IMGUI_ENABLE_INSPECTOR)
+-------------------------------------------------------------------------------------------------]]
+
+---Edit every field the host registered for the object's C++ type, in place.
+---@param object userdata a usertype instance whose type has an inspector layout
+---@return boolean changed
+function ImGui.Inspect(object) end
+
+--[[-----------------------------------------------------------------------------------------------
+    Window Cache (only available when built with SOL_IMGUI_ENABLE_WINDOW_CACHE)
+-------------------------------------------------------------------------------------------------]]
+
+---The next Begin or BeginChild runs its contents at most every seconds, unless the window is hovered, used,
+---moved, resized, scrolled, restyled or invalidated. In between, Begin returns false and the window replays
+---the draw commands of its last refresh. Call it before Begin on every frame the window should stay cached.
+---@param seconds number 0 refreshes every frame
+function ImGui.SetNextWindowRefreshInterval(seconds) end
+
+---Refresh the window next frame, e.g. after the data it shows changed.
+---@param name string as given to Begin or BeginChild, or with the same "###id"
+function ImGui.InvalidateWindow(name) end
+
 --[[-----------------------------------------------------------------------------------------------
     Enum Values
 
@@ -2350,6 +2816,19 @@ ImGuiSliderFlags = {
     WrapAround = 0,
     InvalidMask_ = 0,
 }
+---@enum ImGuiDataType
+ImGuiDataType = {
+    S8 = 0,
+    U8 = 0,
+    S16 = 0,
+    U16 = 0,
+    S32 = 0,
+    U32 = 0,
+    S64 = 0,
+    U64 = 0,
+    Float = 0,
+    Double = 0,
+}
 ---@enum ImGuiMouseButton
 ImGuiMouseButton = {
     Left = 0,
@@ -2386,4 +2865,16 @@ ImGuiCond = {
     FirstUseEver = 0,
     Appearing = 0,
 }
-
+---Common flag combinations, precomputed at Init
+---@enum ImGuiFlagPresets
+ImGuiFlagPresets = {
+    WindowOverlay = 0,
+    WindowHud = 0,
+    WindowFixed = 0,
+    WindowFullscreen = 0,
+    ChildPanel = 0,
+    TreeNodeLeaf = 0,
+    TreeNodeSelectable = 0,
+    InputTextSubmit = 0,
+    InputTextNumeric = 0,
+}
@@ -0,0 +1,45 @@
+// MIT License
+
+// Copyright (c) 2020 MSeys
+
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Optional. Compile this file once with SOL_IMGUI_COMPILED defined for the whole project, along with the same
+// SOL_IMGUI_* feature and module macros, and every other translation unit including sol_ImGui.h only sees
+// declarations of the Init functions instead of instantiating all of the bindings again.
+// The SOL_IMGUI_ENABLE_FFI exports are defined here as well.
+
+#ifndef SOL_IMGUI_COMPILED
+	#error "sol_ImGui.cpp is only needed with SOL_IMGUI_COMPILED, define it for every translation unit including sol_ImGui.h"
+#endif
+
+#define SOL_IMGUI_IMPLEMENTATION
+#include "sol_ImGui.h"
+
+namespace sol_ImGui
+{
+	template void InitEnums<sol::state>(sol::state& lua);
+	template void InitEnums<sol::state_view>(sol::state_view& lua);
+
+	template void InitUserTypes<sol::state>(sol::state& lua);
+	template void InitUserTypes<sol::state_view>(sol::state_view& lua);
+
+	template void Init<sol::state>(sol::state& lua);
+	template void Init<sol::state_view>(sol::state_view& lua);
+}
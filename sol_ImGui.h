@@ -26,9 +26,103 @@
 #include "imgui_stdlib.h"
 #include "sol/sol.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits> // For checking type of argument passed to templated functions sol_ImGui::Init and sol_ImGui::InitEnum
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Internal switches, turned on by the optional features that need them
+#if defined(SOL_IMGUI_ENABLE_ALLOC_TRACKING) || defined(SOL_IMGUI_ENABLE_SCOPE_TIMING) || defined(SOL_IMGUI_ENABLE_SAMPLING_PROFILER) || defined(SOL_IMGUI_ENABLE_TRACE_ZONES) || \
+	defined(SOL_IMGUI_ENABLE_DRAW_COST)
+	#define SOL_IMGUI_TRACK_SCOPES			// Begin/End and BeginChild/EndChild maintain a stack of the windows opened from Lua
+#endif
+#if defined(SOL_IMGUI_ENABLE_ALLOC_TRACKING) || defined(SOL_IMGUI_ENABLE_BINDING_STATS) || defined(SOL_IMGUI_ENABLE_RECORDER) || defined(SOL_IMGUI_VALIDATED)
+	#define SOL_IMGUI_INSTRUMENT_BINDINGS	// every ImGui.* function records its name while it executes
+#endif
+#if defined(SOL_IMGUI_ENABLE_SAMPLING_PROFILER) || defined(SOL_IMGUI_ENABLE_TRACE_ZONES)
+	#define SOL_IMGUI_JSON_OUTPUT			// JSON string escaping for the profile exporters
+#endif
+#if defined(SOL_IMGUI_ENABLE_WATCHDOG) || defined(SOL_IMGUI_VALIDATED)
+	#define SOL_IMGUI_TRACK_STACKS			// the Begin/End and Push/Pop wrappers log the ImGui stacks they open
+#endif
+#if defined(SOL_IMGUI_ENABLE_SAMPLING_PROFILER) || defined(SOL_IMGUI_ENABLE_WATCHDOG)
+	#define SOL_IMGUI_CHAIN_HOOKS			// count hooks installed over another hook keep calling it at its own rate
+#endif
+
+#if !defined(SOL_IMGUI_COMPILED) || defined(SOL_IMGUI_IMPLEMENTATION)
+	#define SOL_IMGUI_DEFINE_INIT			// this translation unit compiles the Init functions and the registration helpers they use
+#endif
+#ifdef SOL_IMGUI_COMPILED
+	#define SOL_IMGUI_INIT_INLINE			// one definition, explicitly instantiated in sol_ImGui.cpp
+#else
+	#define SOL_IMGUI_INIT_INLINE inline
+#endif
+
+#if defined(SOL_IMGUI_UNCHECKED) && defined(SOL_IMGUI_VALIDATED)
+	#error "SOL_IMGUI_UNCHECKED and SOL_IMGUI_VALIDATED select opposite build profiles, define only one of them"
+#endif
+#if defined(SOL_IMGUI_ENABLE_FFI) && defined(SOL_IMGUI_VALIDATED)
+	#error "SOL_IMGUI_VALIDATED reports stack errors as Lua errors, which cannot be raised from LuaJIT FFI calls, use the sol2 bindings to validate scripts"
+#endif
+
+// Binding modules, all registered by default. Define one to 0 to leave its functions out of sol_ImGui::Init.
+#ifndef SOL_IMGUI_MODULE_WINDOWS
+	#define SOL_IMGUI_MODULE_WINDOWS 1		// Begin/End, child windows, window utilities, content region, scrolling
+#endif
+#ifndef SOL_IMGUI_MODULE_LAYOUT
+	#define SOL_IMGUI_MODULE_LAYOUT 1		// parameter stacks, cursor/layout, ID stack, columns
+#endif
+#ifndef SOL_IMGUI_MODULE_WIDGETS
+	#define SOL_IMGUI_MODULE_WIDGETS 1		// text, buttons, combos, drags, sliders, inputs, colors, trees, selectables, list boxes
+#endif
+#ifndef SOL_IMGUI_MODULE_POPUPS
+	#define SOL_IMGUI_MODULE_POPUPS 1		// menus, tooltips, popups and modals
+#endif
+#ifndef SOL_IMGUI_MODULE_TABS
+	#define SOL_IMGUI_MODULE_TABS 1			// tab bars and tab items
+#endif
+#ifndef SOL_IMGUI_MODULE_DOCKING
+	#define SOL_IMGUI_MODULE_DOCKING 1		// dock spaces and ImGuiDockNodeFlags, unless IMGUI_NO_DOCKING is defined
+#endif
+#ifndef SOL_IMGUI_MODULE_UTILITIES
+	#define SOL_IMGUI_MODULE_UTILITIES 1	// logging, clipping, focus, item, text, color, keyboard, mouse and clipboard utilities
+#endif
+#ifndef SOL_IMGUI_MODULE_DRAWLIST
+	#define SOL_IMGUI_MODULE_DRAWLIST 1		// the ImDrawList usertype and GetWindowDrawList
+#endif
+#ifndef SOL_IMGUI_MODULE_ENUMS
+	#define SOL_IMGUI_MODULE_ENUMS 1		// sol_ImGui::Init calls sol_ImGui::InitEnums
+#endif
+
+#ifndef SOL_IMGUI_SCOPE_TIMING_HISTORY
+	#define SOL_IMGUI_SCOPE_TIMING_HISTORY 120	// number of frames the scope timing statistics are computed over
+#endif
+#ifndef SOL_IMGUI_TASK_HISTORY
+	#define SOL_IMGUI_TASK_HISTORY 256			// outcomes of finished tasks kept until they are reported, oldest dropped first
+#endif
+#ifndef SOL_IMGUI_MESSAGE_BYTES
+	#define SOL_IMGUI_MESSAGE_BYTES 48			// longest string or blob a sol_ImGui::MessageQueue message holds
+#endif
+static_assert(SOL_IMGUI_MESSAGE_BYTES <= UINT16_MAX, "SOL_IMGUI_MESSAGE_BYTES must fit the 16-bit length of a message");
 
 #ifdef __clang__
 #pragma clang diagnostic push
@@ -37,1736 +131,6761 @@
 
 namespace sol_ImGui
 {
-	// Windows
-	inline bool Begin(const std::string& name)															{ return ImGui::Begin(name.c_str()); }
-	inline std::tuple<bool, bool> Begin(const std::string& name, bool open)
+#pragma region GC Scheduler
+#ifdef SOL_IMGUI_ENABLE_GC_SCHEDULER	// Define SOL_IMGUI_ENABLE_GC_SCHEDULER to drive the Lua collector from the frame loop
+	enum class GCMode { Incremental, Generational };
+
+	struct GCFrameStats
 	{
-		if (!open) return std::make_tuple(false, false);
+		double		stepMs{};			// time spent inside lua_gc(LUA_GCSTEP) this frame
+		std::size_t	collectedBytes{};	// heap shrink caused by the steps
+		std::size_t	heapBytes{};		// heap size after the steps
+		int			steps{};
+		bool		cycleCompleted{};	// a full collection cycle finished during this frame
+	};
+
+	// Keeps the collector from firing in the middle of Begin/End sequences:
+	// NewFrame() stops automatic collection, Step() pays the debt back in the idle part of the frame within the budget.
+	class GCScheduler
+	{
+	public:
+		static constexpr const char* RegistryKey = "sol_ImGui.GCScheduler";
+
+		explicit GCScheduler(sol::state_view lua, GCMode mode = GCMode::Incremental, double budgetMs = 1.0, int stepSizeKB = 64)
+			: L(lua.lua_state()), budgetMs(budgetMs), stepSizeKB(stepSizeKB)
+		{
+			SetMode(mode);
+			lua_pushlightuserdata(L, this);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		~GCScheduler()
+		{
+			lua_pushnil(L);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			lua_gc(L, LUA_GCRESTART, 0);
+		}
+		GCScheduler(const GCScheduler&) = delete;
+		GCScheduler& operator=(const GCScheduler&) = delete;
 
-		bool shouldDraw = ImGui::Begin(name.c_str(), &open);
+		// Generational mode requires Lua 5.4, older runtimes silently stay incremental.
+		void SetMode(GCMode newMode)
+		{
+		#if LUA_VERSION_NUM >= 504
+			if (newMode == GCMode::Generational)	lua_gc(L, LUA_GCGEN, 0, 0);
+			else									lua_gc(L, LUA_GCINC, 0, 0, 0);
+			mode = newMode;
+		#else
+			mode = GCMode::Incremental;
+		#endif
+		}
+		GCMode GetMode() const									{ return mode; }
+		void SetBudget(double ms)								{ budgetMs = ms > 0.0 ? ms : 0.0; }
+		double GetBudget() const								{ return budgetMs; }
+		void SetStepSize(int kb)								{ stepSizeKB = kb > 0 ? kb : 1; }
+		const GCFrameStats& GetLastFrameStats() const			{ return lastFrame; }
+
+		// Call right after ImGui::NewFrame(), before any Lua UI code runs.
+		void NewFrame()
+		{
+			lua_gc(L, LUA_GCSTOP, 0);
+			frameStartHeap = HeapBytes();
+		}
 
-		if(!open)
+		// Call once the Lua UI pass is done (e.g. after ImGui::Render()).
+		// Steps as many KB as the frame allocated, plus what earlier budgets left unpaid, so a frame that allocated nothing costs nothing.
+		void Step()
 		{
-			ImGui::End();
-			return std::make_tuple(false, false);
+			using clock = std::chrono::steady_clock;
+
+			GCFrameStats stats{};
+			const std::size_t heapBefore{ HeapBytes() };
+			const auto start{ clock::now() };
+			const auto budget{ std::chrono::duration<double, std::milli>(budgetMs) };
+
+			if (heapBefore > frameStartHeap) debtKB += (heapBefore - frameStartHeap + 1023) / 1024;
+			while (debtKB > 0 && clock::now() - start < budget)
+			{
+				const std::size_t stepKB{ std::min(debtKB, static_cast<std::size_t>(stepSizeKB)) };
+				stats.steps++;
+				debtKB -= stepKB;
+				if (lua_gc(L, LUA_GCSTEP, static_cast<int>(stepKB)))
+				{
+					stats.cycleCompleted = true;
+					debtKB = 0;	// the finished cycle collected everything allocated before it
+					break;
+				}
+				// A generational step is a whole minor collection, repeating it within the same frame only burns the budget
+				if (mode == GCMode::Generational)
+				{
+					debtKB = 0;
+					break;
+				}
+			}
+
+			stats.stepMs = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+			stats.heapBytes = HeapBytes();
+			stats.collectedBytes = heapBefore > stats.heapBytes ? heapBefore - stats.heapBytes : 0;
+			lastFrame = stats;
+
+			lua_gc(L, LUA_GCRESTART, 0);
 		}
-		
-		return std::make_tuple(open, shouldDraw);
+
+		static GCScheduler* From(lua_State* L)
+		{
+			lua_getfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			auto* scheduler{ static_cast<GCScheduler*>(lua_touserdata(L, -1)) };
+			lua_pop(L, 1);
+			return scheduler;
+		}
+
+	private:
+		std::size_t HeapBytes() const							{ return static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024 + static_cast<std::size_t>(lua_gc(L, LUA_GCCOUNTB, 0)); }
+
+		lua_State*		L;
+		GCMode			mode{ GCMode::Incremental };
+		double			budgetMs;
+		int				stepSizeKB;
+		GCFrameStats	lastFrame{};
+		std::size_t		frameStartHeap{};	// the frame's allocations are whatever the heap grew above this
+		std::size_t		debtKB{};			// allocated KB not yet stepped
+	};
+
+	inline sol::object GetGCStats(sol::this_state s)
+	{
+		sol::state_view lua{ s };
+		const GCScheduler* scheduler{ GCScheduler::From(s) };
+		if (!scheduler) return sol::make_object(lua, sol::lua_nil);
+
+		const GCFrameStats& stats{ scheduler->GetLastFrameStats() };
+		return lua.create_table_with(
+			"stepMs", stats.stepMs,
+			"collectedBytes", stats.collectedBytes,
+			"heapBytes", stats.heapBytes,
+			"steps", stats.steps,
+			"cycleCompleted", stats.cycleCompleted
+		);
 	}
-	inline std::tuple<bool, bool> Begin(const std::string& name, bool open, int flags)
+	inline void SetGCBudget(sol::this_state s, float budgetMs)								{ if (GCScheduler* scheduler{ GCScheduler::From(s) }) scheduler->SetBudget(budgetMs); }
+#endif
+#pragma endregion GC Scheduler
+
+#pragma region Task Scheduler
+#ifdef SOL_IMGUI_ENABLE_TASK_SCHEDULER	// Define SOL_IMGUI_ENABLE_TASK_SCHEDULER to run Lua coroutines in the idle part of each frame
+	enum class TaskStatus { Running, Done, Failed, Cancelled, Expired };
+
+	struct TaskFrameStats
 	{
-		if (!open) return std::make_tuple(false, false);
-		bool shouldDraw = ImGui::Begin(name.c_str(), &open, static_cast<ImGuiWindowFlags_>(flags));
+		double	runMs{};		// time spent resuming tasks this frame
+		int		resumes{};
+		int		running{};		// tasks still unfinished after this frame
+	};
+
+	// Runs coroutines started with ImGui.StartTask a slice at a time, after the UI pass of each frame. Tasks give the
+	// time back with ImGui.Yield(), for instance whenever ImGui.ShouldYield() reports that the frame budget is spent.
+	class TaskScheduler
+	{
+	public:
+		static constexpr const char* RegistryKey = "sol_ImGui.TaskScheduler";
 
-		if(!open)
+		explicit TaskScheduler(sol::state_view lua, double budgetMs = 2.0)
+			: L(lua.lua_state()), budgetMs(budgetMs)
 		{
-			ImGui::End();
-			return std::make_tuple(false, false);
+			lua_pushlightuserdata(L, this);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
 		}
-		
-		return std::make_tuple(open, shouldDraw);
-	}
-	inline void End()																					{ ImGui::End(); }
-	
-	// Child Windows
-	inline bool BeginChild(const std::string& name)														{ return ImGui::BeginChild(name.c_str()); }
-	inline bool BeginChild(const std::string& name, float sizeX)										{ return ImGui::BeginChild(name.c_str(), { sizeX, 0 }); }
-	inline bool BeginChild(const std::string& name, float sizeX, float sizeY)							{ return ImGui::BeginChild(name.c_str(), { sizeX, sizeY }); }
-	inline bool BeginChild(const std::string& name, float sizeX, float sizeY, int childFlags)			{ return ImGui::BeginChild(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiChildFlags>(childFlags)); }
-	inline bool BeginChild(const std::string& name, float sizeX, float sizeY, int childFlags, int flags){ return ImGui::BeginChild(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiChildFlags>(childFlags), static_cast<ImGuiWindowFlags>(flags)); }
-	inline void EndChild()																				{ ImGui::EndChild(); }
+		~TaskScheduler()
+		{
+			for (const Task& task : tasks) luaL_unref(L, LUA_REGISTRYINDEX, task.thread);
+			lua_pushnil(L);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		TaskScheduler(const TaskScheduler&) = delete;
+		TaskScheduler& operator=(const TaskScheduler&) = delete;
 
-	// Windows Utilities
-	inline bool IsWindowAppearing()																		{ return ImGui::IsWindowAppearing(); }
-	inline bool IsWindowCollapsed()																		{ return ImGui::IsWindowCollapsed(); }
-	inline bool IsWindowFocused()																		{ return ImGui::IsWindowFocused(); }
-	inline bool IsWindowFocused(int flags)																{ return ImGui::IsWindowFocused(static_cast<ImGuiFocusedFlags>(flags)); }
-	inline bool IsWindowHovered()																		{ return ImGui::IsWindowHovered(); }
-	inline bool IsWindowHovered(int flags)																{ return ImGui::IsWindowHovered(static_cast<ImGuiHoveredFlags>(flags)); }
-	inline ImDrawList* GetWindowDrawList()																{ return ImGui::GetWindowDrawList(); }
-	
-	#ifndef IMGUI_NO_DOCKING	// Define IMGUI_NO_DOCKING to disable this for compatibility with ImGui's master branch
-	inline float GetWindowDpiScale()																	{ return ImGui::GetWindowDpiScale(); }
-	#endif
-	
-	inline ImGuiViewport* GetWindowViewport()															{ return nullptr; /* TODO: GetWindowViewport() ==> UNSUPPORTED */ }
-	inline std::tuple<float, float> GetWindowPos()														{ const auto vec2{ ImGui::GetWindowPos() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetWindowSize()														{ const auto vec2{ ImGui::GetWindowSize() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline float GetWindowWidth()																		{ return ImGui::GetWindowWidth(); }
-	inline float GetWindowHeight()																		{ return ImGui::GetWindowHeight(); }
+		void SetBudget(double ms)								{ budgetMs = ms > 0.0 ? ms : 0.0; }
+		double GetBudget() const								{ return budgetMs; }
+		const TaskFrameStats& GetLastFrameStats() const			{ return lastFrame; }
 
-	// Prefer using SetNext...
-	inline void SetNextWindowPos(float posX, float posY)												{ ImGui::SetNextWindowPos({ posX, posY }); }
-	inline void SetNextWindowPos(float posX, float posY, int cond)										{ ImGui::SetNextWindowPos({ posX, posY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetNextWindowPos(float posX, float posY, int cond, float pivotX, float pivotY)			{ ImGui::SetNextWindowPos({ posX, posY }, static_cast<ImGuiCond>(cond), { pivotX, pivotY }); }
-	inline void SetNextWindowSize(float sizeX, float sizeY)												{ ImGui::SetNextWindowSize({ sizeX, sizeY }); }
-	inline void SetNextWindowSize(float sizeX, float sizeY, int cond)									{ ImGui::SetNextWindowSize({ sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetNextWindowSizeConstraints(float minX, float minY, float maxX, float maxY)			{ ImGui::SetNextWindowSizeConstraints({ minX, minY }, { maxX, maxY }); }
-	inline void SetNextWindowContentSize(float sizeX, float sizeY)										{ ImGui::SetNextWindowContentSize({ sizeX, sizeY }); }
-	inline void SetNextWindowCollapsed(bool collapsed)													{ ImGui::SetNextWindowCollapsed(collapsed); }
-	inline void SetNextWindowCollapsed(bool collapsed, int cond)										{ ImGui::SetNextWindowCollapsed(collapsed, static_cast<ImGuiCond>(cond)); }
-	inline void SetNextWindowFocus()																	{ ImGui::SetNextWindowFocus(); }
-	inline void SetNextWindowBgAlpha(float alpha)														{ ImGui::SetNextWindowBgAlpha(alpha); }
-	inline void SetWindowPos(float posX, float posY)													{ ImGui::SetWindowPos({ posX, posY }); }
-	inline void SetWindowPos(float posX, float posY, int cond)											{ ImGui::SetWindowPos({ posX, posY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowSize(float sizeX, float sizeY)													{ ImGui::SetWindowSize({ sizeX, sizeY }); }
-	inline void SetWindowSize(float sizeX, float sizeY, int cond)										{ ImGui::SetWindowSize({ sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowCollapsed(bool collapsed)														{ ImGui::SetWindowCollapsed(collapsed); }
-	inline void SetWindowCollapsed(bool collapsed, int cond)											{ ImGui::SetWindowCollapsed(collapsed, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowFocus()																		{ ImGui::SetWindowFocus(); }
-	inline void SetWindowFontScale(float scale)															{ ImGui::SetWindowFontScale(scale); }
-	inline void SetWindowPos(const std::string& name, float posX, float posY)							{ ImGui::SetWindowPos(name.c_str(), { posX, posY }); }
-	inline void SetWindowPos(const std::string& name, float posX, float posY, int cond)					{ ImGui::SetWindowPos(name.c_str(), { posX, posY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowSize(const std::string& name, float sizeX, float sizeY)						{ ImGui::SetWindowSize(name.c_str(), { sizeX, sizeY }); }
-	inline void SetWindowSize(const std::string& name, float sizeX, float sizeY, int cond)				{ ImGui::SetWindowSize(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowCollapsed(const std::string& name, bool collapsed)								{ ImGui::SetWindowCollapsed(name.c_str(), collapsed); }
-	inline void SetWindowCollapsed(const std::string& name, bool collapsed, int cond)					{ ImGui::SetWindowCollapsed(name.c_str(), collapsed, static_cast<ImGuiCond>(cond)); }
-	inline void SetWindowFocus(const std::string& name)													{ ImGui::SetWindowFocus(name.c_str()); }
+		// Higher priorities run first, then earlier deadlines. A task still running deadlineMs after it started is
+		// stopped and reported as expired, 0 means no deadline.
+		int Start(const sol::function& function, int priority = 0, double deadlineMs = 0.0)
+		{
+			lua_State* thread{ lua_newthread(L) };
+			const int reference{ luaL_ref(L, LUA_REGISTRYINDEX) };
+			function.push(thread);
+			const int id{ ++lastId };
+			tasks.push_back({ id, priority, deadlineMs > 0.0 ? clock::now() + ToDuration(deadlineMs) : clock::time_point::max(), reference, thread, false });
+			statuses[id] = { TaskStatus::Running, {} };
+			return id;
+		}
+		// Safe to call from a task, including on itself: it stops at its next yield
+		bool Cancel(int id)
+		{
+			for (Task& task : tasks)
+				if (task.id == id && !task.cancelled && !task.finished) return task.cancelled = true;
+			return false;
+		}
+		std::optional<TaskStatus> GetStatus(int id) const		{ const auto status{ statuses.find(id) }; return status != statuses.end() ? std::optional<TaskStatus>{ status->second.status } : std::nullopt; }
+		const std::string& GetError(int id) const				{ static const std::string none; const auto status{ statuses.find(id) }; return status != statuses.end() ? status->second.error : none; }
+		// Drops the outcome of a finished task once it has been reported, running tasks are kept
+		void Forget(int id)										{ const auto status{ statuses.find(id) }; if (status != statuses.end() && status->second.status != TaskStatus::Running) statuses.erase(status); }
 
-	// Content Region
-	inline std::tuple<float, float> GetContentRegionMax()												{ const auto vec2{ ImGui::GetContentRegionMax() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetContentRegionAvail()												{ const auto vec2{ ImGui::GetContentRegionAvail() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetWindowContentRegionMin()											{ const auto vec2{ ImGui::GetWindowContentRegionMin() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetWindowContentRegionMax()											{ const auto vec2{ ImGui::GetWindowContentRegionMax() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline float GetWindowContentRegionWidth()															{ return ImGui::GetWindowContentRegionMax().x - ImGui::GetWindowContentRegionMin().x; }
+		// Inside a task: true once this frame's budget is spent
+		bool ShouldYield() const								{ return stepping && clock::now() - stepStart >= ToDuration(budgetMs); }
 
-	// Windows Scrolling
-	inline float GetScrollX()																			{ return ImGui::GetScrollX(); }
-	inline float GetScrollY()																			{ return ImGui::GetScrollY(); }
-	inline float GetScrollMaxX()																		{ return ImGui::GetScrollMaxX(); }
-	inline float GetScrollMaxY()																		{ return ImGui::GetScrollMaxY(); }
-	inline void SetScrollX(float scrollX)																{ ImGui::SetScrollX(scrollX); }
-	inline void SetScrollY(float scrollY)																{ ImGui::SetScrollY(scrollY); }
-	inline void SetScrollHereX()																		{ ImGui::SetScrollHereX(); }
-	inline void SetScrollHereX(float centerXRatio)														{ ImGui::SetScrollHereX(centerXRatio); }
-	inline void SetScrollHereY()																		{ ImGui::SetScrollHereY(); }
-	inline void SetScrollHereY(float centerYRatio)														{ ImGui::SetScrollHereY(centerYRatio); }	
-	inline void SetScrollFromPosX(float localX)															{ ImGui::SetScrollFromPosX(localX); }
-	inline void SetScrollFromPosX(float localX, float centerXRatio)										{ ImGui::SetScrollFromPosX(localX, centerXRatio); }
-	inline void SetScrollFromPosY(float localY)															{ ImGui::SetScrollFromPosY(localY); }
-	inline void SetScrollFromPosY(float localY, float centerYRatio)										{ ImGui::SetScrollFromPosY(localY, centerYRatio); }
+		// Call once the Lua UI pass is done (e.g. after ImGui::Render()). Resumes the tasks in priority order, over
+		// and over, until they have all finished or yielded after the budget ran out.
+		void Step()
+		{
+			TaskFrameStats stats{};
+			stepStart = clock::now();
+			stepping = true;
+			std::stable_sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) { return a.priority != b.priority ? a.priority > b.priority : a.deadline < b.deadline; });
+
+			// At least one resume per frame, so a zero budget or a slow UI pass still lets the top task progress
+			for (bool resumed{ true }; resumed && (stats.resumes == 0 || !ShouldYield());)
+			{
+				resumed = false;
+				for (std::size_t i = 0; i < tasks.size() && (stats.resumes == 0 || !ShouldYield()); i++)	// tasks started meanwhile are appended and run later in this pass
+				{
+					if (tasks[i].cancelled || tasks[i].finished) continue;
+					if (clock::now() >= tasks[i].deadline)
+					{
+						Finish(tasks[i], TaskStatus::Expired, {});
+						continue;
+					}
+					const int status{ Resume(tasks[i].state) };
+					stats.resumes++;
+					resumed = true;
+					if (status == LUA_YIELD) continue;
+					if (status == 0)	// LUA_OK, which Lua 5.1 does not define
+						Finish(tasks[i], TaskStatus::Done, {});
+					else
+					{
+						luaL_traceback(L, tasks[i].state, lua_tostring(tasks[i].state, -1), 0);
+						Finish(tasks[i], TaskStatus::Failed, lua_tostring(L, -1));
+						lua_pop(L, 1);
+					}
+				}
+			}
+
+			stepping = false;
+			for (Task& task : tasks)
+				if (task.cancelled && !task.finished) Finish(task, TaskStatus::Cancelled, {});
+			tasks.erase(std::remove_if(tasks.begin(), tasks.end(), [](const Task& task) { return task.finished; }), tasks.end());
+			stats.running = static_cast<int>(tasks.size());
+			stats.runMs = std::chrono::duration<double, std::milli>(clock::now() - stepStart).count();
+			lastFrame = stats;
+		}
 
-	// Parameters stacks (shared)
-	inline void PushFont(ImFont* pFont)																	{ ImGui::PushFont(pFont); }
-	inline void PopFont()																				{ ImGui::PopFont(); }
-	inline void PushStyleColor(int idx, int col)														{ ImGui::PushStyleColor(static_cast<ImGuiCol>(idx), ImU32(col)); }
-	inline void PushStyleColor(int idx, float colR, float colG, float colB, float colA)					{ ImGui::PushStyleColor(static_cast<ImGuiCol>(idx), { colR, colG, colB, colA }); }
-	inline void PopStyleColor()																			{ ImGui::PopStyleColor(); }
-	inline void PopStyleColor(int count)																{ ImGui::PopStyleColor(count); }
-	inline void PushStyleVar(int idx, float val)														{ ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), val); }
-	inline void PushStyleVar(int idx, float valX, float valY)											{ ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), { valX, valY }); }
-	inline void PopStyleVar()																			{ ImGui::PopStyleVar(); }
-	inline void PopStyleVar(int count)																	{ ImGui::PopStyleVar(count); }
-	inline std::tuple<float, float, float, float> GetStyleColorVec4(int idx)							{ const auto col{ ImGui::GetStyleColorVec4(static_cast<ImGuiCol>(idx)) };	return std::make_tuple(col.x, col.y, col.z, col.w); }
-	inline ImFont* GetFont()																			{ return ImGui::GetFont(); }
-	inline float GetFontSize()																			{ return ImGui::GetFontSize(); }
-	inline std::tuple<float, float> GetFontTexUvWhitePixel()											{ const auto vec2{ ImGui::GetFontTexUvWhitePixel() };	return std::make_tuple(vec2.x, vec2.y); }
-	inline int GetColorU32(int idx, float alphaMul)														{ return ImGui::GetColorU32(static_cast<ImGuiCol>(idx), alphaMul); }
-	inline int GetColorU32(float colR, float colG, float colB, float colA)								{ return ImGui::GetColorU32({ colR, colG, colB, colA }); }
-	inline int GetColorU32(int col)																		{ return ImGui::GetColorU32(ImU32(col)); }
-	
-	// Parameters stacks (current window)
-	inline void PushItemWidth(float itemWidth)															{ ImGui::PushItemWidth(itemWidth); }
-	inline void PopItemWidth()																			{ ImGui::PopItemWidth(); }
-	inline void SetNextItemWidth(float itemWidth)														{ ImGui::SetNextItemWidth(itemWidth); }
-	inline float CalcItemWidth()																		{ return ImGui::CalcItemWidth(); }
-	inline void PushTextWrapPos()																		{ ImGui::PushTextWrapPos(); }
-	inline void PushTextWrapPos(float wrapLocalPosX)													{ ImGui::PushTextWrapPos(wrapLocalPosX); }
-	inline void PopTextWrapPos()																		{ ImGui::PopTextWrapPos(); }
-	//inline void PushAllowKeyboardFocus(bool allowKeyboardFocus)											{ ImGui::PushAllowKeyboardFocus(allowKeyboardFocus); }
-	//inline void PopAllowKeyboardFocus()																	{ ImGui::PopAllowKeyboardFocus(); }
-	//inline void PushButtonRepeat(bool repeat)															{ ImGui::PushButtonRepeat(repeat); }
-	//inline void PopButtonRepeat()																		{ ImGui::PopButtonRepeat(); }
+		static TaskScheduler* From(lua_State* L)
+		{
+			lua_getfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			auto* scheduler{ static_cast<TaskScheduler*>(lua_touserdata(L, -1)) };
+			lua_pop(L, 1);
+			return scheduler;
+		}
 
-	// Cursor / Layout
-	inline void Separator()																				{ ImGui::Separator(); }
-	inline void SameLine()																				{ ImGui::SameLine(); }
-	inline void SameLine(float offsetFromStartX)														{ ImGui::SameLine(offsetFromStartX); }
-	inline void SameLine(float offsetFromStartX, float spacing)											{ ImGui::SameLine(offsetFromStartX, spacing); }
-	inline void NewLine()																				{ ImGui::NewLine(); }
-	inline void Spacing()																				{ ImGui::Spacing(); }
-	inline void Dummy(float sizeX, float sizeY)															{ ImGui::Dummy({ sizeX, sizeY }); }
-	inline void Indent()																				{ ImGui::Indent(); }
-	inline void Indent(float indentW)																	{ ImGui::Indent(indentW); }
-	inline void Unindent()																				{ ImGui::Unindent(); }
-	inline void Unindent(float indentW)																	{ ImGui::Unindent(indentW); }
-	inline void BeginGroup()																			{ ImGui::BeginGroup(); }
-	inline void EndGroup()																				{ ImGui::EndGroup(); }
-	inline std::tuple<float, float> GetCursorPos()														{ const auto vec2{ ImGui::GetCursorPos() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline float GetCursorPosX()																		{ return ImGui::GetCursorPosX(); }
-	inline float GetCursorPosY()																		{ return ImGui::GetCursorPosY(); }
-	inline void SetCursorPos(float localX, float localY)												{ ImGui::SetCursorPos({ localX, localY }); }
-	inline void SetCursorPosX(float localX)																{ ImGui::SetCursorPosX(localX); }
-	inline void SetCursorPosY(float localY)																{ ImGui::SetCursorPosY(localY); }
-	inline std::tuple<float, float> GetCursorStartPos()													{ const auto vec2{ ImGui::GetCursorStartPos() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetCursorScreenPos()												{ const auto vec2{ ImGui::GetCursorScreenPos() };  return std::make_tuple(vec2.x, vec2.y); }
-	inline void SetCursorScreenPos(float posX, float posY)												{ ImGui::SetCursorScreenPos({ posX, posY }); }
-	inline void AlignTextToFramePadding()																{ ImGui::AlignTextToFramePadding(); }
-	inline float GetTextLineHeight()																	{ return ImGui::GetTextLineHeight(); }
-	inline float GetTextLineHeightWithSpacing()															{ return ImGui::GetTextLineHeightWithSpacing(); }
-	inline float GetFrameHeight()																		{ return ImGui::GetFrameHeight(); }
-	inline float GetFrameHeightWithSpacing()															{ return ImGui::GetFrameHeightWithSpacing(); }
+	private:
+		using clock = std::chrono::steady_clock;
 
-	// ID stack / scopes
-	inline void PushID(const std::string& stringID)														{ ImGui::PushID(stringID.c_str()); }
-	inline void PushID(const std::string& stringIDBegin, const std::string& stringIDEnd)				{ ImGui::PushID(stringIDBegin.c_str(), stringIDEnd.c_str()); }
-	inline void PushID(const void*)																		{ /* TODO: PushID(void*) ==> UNSUPPORTED */ }
-	inline void PushID(int intID)																		{ ImGui::PushID(intID); }
-	inline void PopID()																					{ ImGui::PopID(); }
-	inline int GetID(const std::string& stringID)														{ return ImGui::GetID(stringID.c_str()); }
-	inline int GetID(const std::string& stringIDBegin, const std::string& stringIDEnd)					{ return ImGui::GetID(stringIDBegin.c_str(), stringIDEnd.c_str()); }
-	inline int GetID(const void*)																		{ return 0;  /* TODO: GetID(void*) ==> UNSUPPORTED */ }
+		struct Task
+		{
+			int					id;
+			int					priority;
+			clock::time_point	deadline;
+			int					thread;		// registry reference keeping the coroutine alive
+			lua_State*			state;
+			bool				cancelled;
+			bool				finished{};
+		};
+		struct Outcome
+		{
+			TaskStatus			status;
+			std::string			error;		// with the coroutine's traceback, for failed tasks
+		};
 
-	// Widgets: Text
-	inline void TextUnformatted(const std::string& text)												{ ImGui::TextUnformatted(text.c_str()); }
-	inline void TextUnformatted(const std::string& text, const std::string& textEnd)					{ ImGui::TextUnformatted(text.c_str(), textEnd.c_str()); }
-	inline void Text(const std::string& text)															{ ImGui::Text(text.c_str()); }
-	inline void TextColored(float colR, float colG, float colB, float colA, const std::string& text)	{ ImGui::TextColored({ colR, colG, colB, colA }, text.c_str()); }
-	inline void TextDisabled(const std::string& text)													{ ImGui::TextDisabled(text.c_str()); }
-	inline void TextWrapped(const std::string text)														{ ImGui::TextWrapped(text.c_str()); }
-	inline void LabelText(const std::string& label, const std::string& text)							{ ImGui::LabelText(label.c_str(), text.c_str()); }
-	inline void BulletText(const std::string& text)														{ ImGui::BulletText(text.c_str()); }
+		static clock::duration ToDuration(double ms)			{ return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double, std::milli>(ms)); }
 
-	// Widgets: Main
-	inline bool Button(const std::string& label)														{ return ImGui::Button(label.c_str()); }
-	inline bool Button(const std::string& label, float sizeX, float sizeY)								{ return ImGui::Button(label.c_str(), { sizeX, sizeY }); }
-	inline bool SmallButton(const std::string& label)													{ return ImGui::SmallButton(label.c_str()); }
-	inline bool InvisibleButton(const std::string& stringID, float sizeX, float sizeY)					{ return ImGui::InvisibleButton(stringID.c_str(), { sizeX, sizeY }); }
-	inline bool ArrowButton(const std::string& stringID, int dir)										{ return ImGui::ArrowButton(stringID.c_str(), static_cast<ImGuiDir>(dir)); }
-	inline void Image(void* textureID, float width, float height)										{ ImGui::Image(textureID, ImVec2(width, height)); }
-	//inline void ImageButton()																			{ /* TODO: ImageButton(...) ==> UNSUPPORTED */ }
-	inline std::tuple<bool, bool> Checkbox(const std::string& label, bool v)
-	{
-		bool value{ v };
-		bool pressed = ImGui::Checkbox(label.c_str(), &value);
+		// Values passed to ImGui.Yield() and returned by the task are dropped
+		int Resume(lua_State* thread)
+		{
+		#if LUA_VERSION_NUM >= 504
+			int results{};
+			const int status{ lua_resume(thread, L, 0, &results) };
+			if (status == LUA_OK || status == LUA_YIELD) lua_pop(thread, results);
+		#elif LUA_VERSION_NUM >= 502
+			const int status{ lua_resume(thread, L, 0) };
+			if (status == LUA_OK || status == LUA_YIELD) lua_settop(thread, 0);
+		#else
+			const int status{ lua_resume(thread, 0) };
+			if (status == 0 || status == LUA_YIELD) lua_settop(thread, 0);
+		#endif
+			return status;
+		}
 
-		return std::make_tuple(value, pressed);
-	}
-	inline bool CheckboxFlags()																			{ return false; /* TODO: CheckboxFlags(...) ==> UNSUPPORTED */ }
-	inline bool RadioButton(const std::string& label, bool active)										{ return ImGui::RadioButton(label.c_str(), active); }
-	inline std::tuple<int, bool> RadioButton(const std::string& label, int v, int vButton)				{ bool ret{ ImGui::RadioButton(label.c_str(), &v, vButton) }; return std::make_tuple(v, ret); }
-	inline void ProgressBar(float fraction)																{ ImGui::ProgressBar(fraction); }
-	inline void ProgressBar(float fraction, float sizeX, float sizeY)									{ ImGui::ProgressBar(fraction, { sizeX, sizeY }); }
-	inline void ProgressBar(float fraction, float sizeX, float sizeY, const std::string& overlay)		{ ImGui::ProgressBar(fraction, { sizeX, sizeY }, overlay.c_str()); }
-	inline void Bullet()																				{ ImGui::Bullet(); }
+		void Finish(Task& task, TaskStatus status, std::string error)
+		{
+			task.finished = true;
+			luaL_unref(L, LUA_REGISTRYINDEX, task.thread);
+			statuses[task.id] = { status, std::move(error) };
+
+			// Outcomes nobody asks for only live for the last SOL_IMGUI_TASK_HISTORY finished tasks
+			if (finished.size() < SOL_IMGUI_TASK_HISTORY) finished.push_back(task.id);
+			else
+			{
+				statuses.erase(finished[nextFinished]);
+				finished[nextFinished] = task.id;
+				nextFinished = (nextFinished + 1) % SOL_IMGUI_TASK_HISTORY;
+			}
+		}
 
-	// Widgets: Combo Box
-	inline bool BeginCombo(const std::string& label, const std::string& previewValue)					{ return ImGui::BeginCombo(label.c_str(), previewValue.c_str()); }
-	inline bool BeginCombo(const std::string& label, const std::string& previewValue, int flags)		{ return ImGui::BeginCombo(label.c_str(), previewValue.c_str(), static_cast<ImGuiComboFlags>(flags)); }
-	inline void EndCombo()																				{ ImGui::EndCombo(); }
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const sol::table& items, int itemsCount)
+		lua_State*							L;
+		double								budgetMs;
+		std::vector<Task>					tasks;
+		std::unordered_map<int, Outcome>	statuses;
+		std::vector<int>					finished;		// ring of the ids whose outcome is kept
+		std::size_t							nextFinished{};	// oldest entry of the ring once it is full
+		int									lastId{};
+		clock::time_point					stepStart;
+		bool								stepping{};
+		TaskFrameStats						lastFrame{};
+	};
+
+	namespace detail
 	{
-		std::vector<std::string> strings;
-		for (int i{ 1 }; i <= itemsCount; i++)
+		inline TaskScheduler& AttachedTaskScheduler(lua_State* L)
 		{
-			const auto& stringItem = items.get<sol::optional<std::string>>(i);
-			strings.push_back(stringItem.value_or("Missing"));
+			TaskScheduler* scheduler{ TaskScheduler::From(L) };
+			if (!scheduler) throw sol::error("no sol_ImGui::TaskScheduler is attached to this state");
+			return *scheduler;
 		}
-		
-		std::vector<const char*> cstrings;
-		for (auto& string : strings)
-			cstrings.push_back(string.c_str());
-			
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, cstrings.data(), itemsCount);
-		return std::make_tuple(currentItem, clicked);
 	}
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const sol::table& items, int itemsCount, int popupMaxHeightInItems)
+
+	inline int StartTask(sol::this_state s, const sol::function& function, sol::optional<int> priority, sol::optional<double> deadlineMs)
 	{
-		std::vector<std::string> strings;
-		for (int i{ 1 }; i <= itemsCount; i++)
+		return detail::AttachedTaskScheduler(s).Start(function, priority.value_or(0), deadlineMs.value_or(0.0));
+	}
+	inline bool CancelTask(sol::this_state s, int id)											{ return detail::AttachedTaskScheduler(s).Cancel(id); }
+	// "running", "done", "failed" with the error, "cancelled" or "expired". A final state is reported once, after which
+	// the id is forgotten and, like ids that were never started, gives nil.
+	inline std::tuple<sol::object, sol::object> GetTaskStatus(sol::this_state s, int id)
+	{
+		static constexpr const char* names[]{ "running", "done", "failed", "cancelled", "expired" };
+		TaskScheduler& scheduler{ detail::AttachedTaskScheduler(s) };
+		const auto status{ scheduler.GetStatus(id) };
+		if (!status) return std::make_tuple(sol::make_object(s, sol::lua_nil), sol::make_object(s, sol::lua_nil));
+		auto result{ std::make_tuple(sol::make_object(s, names[static_cast<int>(*status)]),
+			*status == TaskStatus::Failed ? sol::make_object(s, scheduler.GetError(id)) : sol::make_object(s, sol::lua_nil)) };
+		scheduler.Forget(id);
+		return result;
+	}
+	inline bool ShouldYield(sol::this_state s)													{ const TaskScheduler* scheduler{ TaskScheduler::From(s) }; return scheduler && scheduler->ShouldYield(); }
+	inline sol::object GetTaskStats(sol::this_state s)
+	{
+		sol::state_view lua{ s };
+		const TaskScheduler* scheduler{ TaskScheduler::From(s) };
+		if (!scheduler) return sol::make_object(lua, sol::lua_nil);
+
+		const TaskFrameStats& stats{ scheduler->GetLastFrameStats() };
+		return lua.create_table_with(
+			"runMs", stats.runMs,
+			"resumes", stats.resumes,
+			"running", stats.running
+		);
+	}
+#endif
+#pragma endregion Task Scheduler
+
+#pragma region Scope Tracking
+#if defined(SOL_IMGUI_TRACK_SCOPES) || defined(SOL_IMGUI_INSTRUMENT_BINDINGS)
+	namespace detail
+	{
+		// Returned pointers stay valid for the lifetime of the process, so names can be used as cheap map keys
+		inline const char* InternName(const char* name)
 		{
-			const auto& stringItem = items.get<sol::optional<std::string>>(i);
-			strings.push_back(stringItem.value_or("Missing"));
+			static std::mutex mutex;
+			static std::unordered_set<std::string> names;
+			std::lock_guard<std::mutex> lock{ mutex };
+			return names.emplace(name).first->c_str();
 		}
 
-		std::vector<const char*> cstrings;
-		for (auto& string : strings)
-			cstrings.push_back(string.c_str());
-
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, cstrings.data(), itemsCount, popupMaxHeightInItems);
-		return std::make_tuple(currentItem, clicked);
-	}
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const std::string& itemsSeparatedByZeros)
-	{
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, itemsSeparatedByZeros.c_str());
-		return std::make_tuple(currentItem, clicked);
+		struct ScopeState
+		{
+			std::vector<const char*>	windows;		// interned names of the windows opened through the bindings
+			const char*					binding{};		// interned name of the ImGui.* function currently executing
+			const char*					script{};		// interned name set by the host with SetCurrentScript()
+			lua_State*					lua{};			// state running the current ImGui.* function
+		};
+		inline ScopeState& Scopes()																{ static thread_local ScopeState state; return state; }
+		inline const char* CurrentWindow()														{ const auto& windows{ Scopes().windows }; return windows.empty() ? nullptr : windows.back(); }
+		inline const char* CurrentBinding()														{ return Scopes().binding; }
+		inline const char* CurrentScript()														{ return Scopes().script; }
 	}
-	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const std::string& itemsSeparatedByZeros, int popupMaxHeightInItems)
+
+	// Lets the host tell which script (plugin, panel file...) is about to run on this thread, for per-script attribution
+	inline void SetCurrentScript(const std::string& name)										{ detail::Scopes().script = name.empty() ? nullptr : detail::InternName(name.c_str()); }
+#endif
+#pragma endregion Scope Tracking
+
+#pragma region Allocation Tracking
+#ifdef SOL_IMGUI_ENABLE_ALLOC_TRACKING	// Define SOL_IMGUI_ENABLE_ALLOC_TRACKING to attribute Lua allocations to windows and bindings
+	struct AllocStats
 	{
-		bool clicked = ImGui::Combo(label.c_str(), &currentItem, itemsSeparatedByZeros.c_str(), popupMaxHeightInItems);
-		return std::make_tuple(currentItem, clicked);
-	}
-	// TODO: 3rd Combo from ImGui not Supported
+		std::size_t	bytes{};
+		std::size_t	count{};
+	};
 
-	// Widgets: Drags
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v)																											{ bool used = ImGui::DragFloat(label.c_str(), &v); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed)																							{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min)																				{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max)																{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max, const std::string& format)										{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max, const std::string& format, int flags)							{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags) flags); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v)
+	struct AllocFrameStats
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value);
+		AllocStats									total;
+		std::unordered_map<const char*, AllocStats>	windows;	// keyed by interned window name, nullptr outside of any window
+		std::unordered_map<const char*, AllocStats>	bindings;	// keyed by interned binding name, nullptr while plain Lua code runs
+	};
+
+	// Installs a lua_Alloc in front of the state's allocator and charges every growth to the current window and binding.
+	// Must be destroyed before the state is closed.
+	class AllocTracker
+	{
+	public:
+		static constexpr const char* RegistryKey = "sol_ImGui.AllocTracker";
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		explicit AllocTracker(sol::state_view lua)
+			: L(lua.lua_state())
+		{
+			previousAlloc = lua_getallocf(L, &previousUserData);
+			lua_setallocf(L, Allocate, this);
+			lua_pushlightuserdata(L, this);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		~AllocTracker()
+		{
+			lua_pushnil(L);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			lua_setallocf(L, previousAlloc, previousUserData);
+		}
+		AllocTracker(const AllocTracker&) = delete;
+		AllocTracker& operator=(const AllocTracker&) = delete;
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed);
+		// Call once per frame, the frame that just ended becomes GetLastFrameStats()
+		void NewFrame()
+		{
+			std::swap(lastFrame, currentFrame);
+			currentFrame.total = {};
+			currentFrame.windows.clear();
+			currentFrame.bindings.clear();
+		}
+		const AllocFrameStats& GetLastFrameStats() const										{ return lastFrame; }
+		const AllocFrameStats& GetCurrentFrameStats() const										{ return currentFrame; }
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		static AllocTracker* From(lua_State* L)
+		{
+			lua_getfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			auto* tracker{ static_cast<AllocTracker*>(lua_touserdata(L, -1)) };
+			lua_pop(L, 1);
+			return tracker;
+		}
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min);
+	private:
+		// Lua calls it from C frames (lua_newstate, the GC...) that must never be unwound through
+		static void* Allocate(void* ud, void* ptr, std::size_t osize, std::size_t nsize) noexcept
+		{
+			auto* self{ static_cast<AllocTracker*>(ud) };
+			// When ptr is NULL, osize holds the type of the object being created rather than a size
+			const std::size_t oldSize{ ptr ? osize : 0 };
+			if (nsize > oldSize) self->Record(nsize - oldSize);
+			return self->previousAlloc(self->previousUserData, ptr, osize, nsize);
+		}
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		void Record(std::size_t bytes) noexcept
+		{
+			const auto charge{ [bytes](AllocStats& stats) { stats.bytes += bytes; stats.count++; } };
+			charge(currentFrame.total);
+			// The first sample of a name inserts into the maps, when that fails the sample only counts towards the total
+			try
+			{
+				charge(currentFrame.windows[detail::CurrentWindow()]);
+				charge(currentFrame.bindings[detail::CurrentBinding()]);
+			}
+			catch (...) {}
+		}
 
-		return std::make_tuple(float2, used);
+		lua_State*		L;
+		lua_Alloc		previousAlloc{};
+		void*			previousUserData{};
+		AllocFrameStats	currentFrame;
+		AllocFrameStats	lastFrame;
+	};
+
+	inline sol::object GetAllocStats(sol::this_state s)
+	{
+		sol::state_view lua{ s };
+		const AllocTracker* tracker{ AllocTracker::From(s) };
+		if (!tracker) return sol::make_object(lua, sol::lua_nil);
+
+		const AllocFrameStats& stats{ tracker->GetLastFrameStats() };
+		const auto toTable{ [&lua](const std::unordered_map<const char*, AllocStats>& entries, const char* unnamed) {
+			sol::table table{ lua.create_table(0, static_cast<int>(entries.size())) };
+			for (const auto& [name, entry] : entries)
+				table[name ? name : unnamed] = lua.create_table_with("bytes", entry.bytes, "count", entry.count);
+			return table;
+		} };
+
+		return lua.create_table_with(
+			"bytes", stats.total.bytes,
+			"count", stats.total.count,
+			"windows", toTable(stats.windows, "<none>"),
+			"bindings", toTable(stats.bindings, "<lua>")
+		);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+#endif
+#pragma endregion Allocation Tracking
+
+#pragma region Scope Timing
+#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING	// Define SOL_IMGUI_ENABLE_SCOPE_TIMING to time windows and user scopes
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max);
+		using TimingClock = std::chrono::steady_clock;
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		struct TimedScope
+		{
+			const char*				name;
+			TimingClock::time_point	start;
+		};
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		// Per-frame inclusive time of one scope over the last SOL_IMGUI_SCOPE_TIMING_HISTORY frames it ran in
+		struct ScopeHistory
+		{
+			std::array<float, SOL_IMGUI_SCOPE_TIMING_HISTORY>	samples{};
+			int													count{};
+			int													next{};
+			int													idleFrames{};	// frames since the last sample
+
+			void Push(float ms)
+			{
+				samples[next] = ms;
+				next = (next + 1) % SOL_IMGUI_SCOPE_TIMING_HISTORY;
+				if (count < SOL_IMGUI_SCOPE_TIMING_HISTORY) count++;
+				idleFrames = 0;
+			}
+			float Last() const																	{ return samples[(next + SOL_IMGUI_SCOPE_TIMING_HISTORY - 1) % SOL_IMGUI_SCOPE_TIMING_HISTORY]; }
+		};
+
+		// One kind of scope: its open stack and its samples, keyed by interned name
+		struct TimedScopes
+		{
+			std::vector<TimedScope>							stack;
+			std::unordered_map<const char*, double>			frame;		// milliseconds accumulated by each scope during the current frame
+			std::unordered_map<const char*, ScopeHistory>	history;
+		};
+
+		// Windows and user scopes nest and accumulate independently, so an unbalanced user scope is never closed by a window's End
+		// and a user scope named like its window is reported on its own
+		struct TimingState
+		{
+			TimedScopes	windows;
+			TimedScopes	scopes;
+		};
+		inline TimingState& Timings()															{ static thread_local TimingState state; return state; }
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		inline void BeginTimedScope(TimedScopes& scopes, const char* name)						{ scopes.stack.push_back({ name, TimingClock::now() }); }
+		inline void EndTimedScope(TimedScopes& scopes)
+		{
+			const auto end{ TimingClock::now() };
+			if (scopes.stack.empty()) return;
 
-		return std::make_tuple(float2, used);
+			const TimedScope& scope{ scopes.stack.back() };
+			scopes.frame[scope.name] += std::chrono::duration<double, std::milli>(end - scope.start).count();
+			scopes.stack.pop_back();
+		}
+		// Scopes without a sample for a whole history are dropped, so per-item names and closed windows don't pile up
+		inline void RollTimedScopes(TimedScopes& scopes)
+		{
+			for (auto& [name, history] : scopes.history) history.idleFrames++;
+			for (const auto& [name, ms] : scopes.frame) scopes.history[name].Push(static_cast<float>(ms));
+			for (auto entry{ scopes.history.begin() }; entry != scopes.history.end();)
+				entry = entry->second.idleFrames >= SOL_IMGUI_SCOPE_TIMING_HISTORY ? scopes.history.erase(entry) : std::next(entry);
+			scopes.frame.clear();
+			scopes.stack.clear();
+		}
+		inline void RollScopeTimings()
+		{
+			RollTimedScopes(Timings().windows);
+			RollTimedScopes(Timings().scopes);
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+	struct ScopeTiming
+	{
+		const char*	name;
+		const char*	kind;	// "window" or "scope"
+		float		lastMs;
+		float		meanMs;
+		float		p99Ms;
+		float		maxMs;
+		int			samples;
+	};
+
+	// Statistics of every window and user scope seen on this thread, most expensive (by mean) first
+	inline std::vector<ScopeTiming> GetScopeTimings()
+	{
+		std::vector<ScopeTiming> result;
+		std::vector<float> sorted;
+		const auto collect{ [&result, &sorted](const detail::TimedScopes& scopes, const char* kind) {
+			for (const auto& [name, history] : scopes.history)
+			{
+				sorted.assign(history.samples.begin(), history.samples.begin() + history.count);
+				std::sort(sorted.begin(), sorted.end());
+
+				float sum{};
+				for (const float sample : sorted) sum += sample;
+				const auto p99Index{ static_cast<std::size_t>(std::ceil(0.99 * sorted.size())) - 1 };
+
+				result.push_back({ name, kind, history.Last(), sum / history.count, sorted[p99Index], sorted.back(), history.count });
+			}
+		} };
+		collect(detail::Timings().windows, "window");
+		collect(detail::Timings().scopes, "scope");
+		std::sort(result.begin(), result.end(), [](const ScopeTiming& a, const ScopeTiming& b) { return a.meanMs > b.meanMs; });
+		return result;
+	}
 
-		return std::make_tuple(float2, used);
+	// Overlay ranking windows and user scopes by cost. Drawn with ImGui directly so it doesn't time itself.
+	inline void ShowScopeTimingsWindow(bool* open)
+	{
+		if (ImGui::Begin("Lua Scope Timings", open))
+		{
+			const ImGuiTableFlags flags{ ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp };
+			if (ImGui::BeginTable("##timings", 5, flags))
+			{
+				ImGui::TableSetupScrollFreeze(0, 1);
+				ImGui::TableSetupColumn("Scope", ImGuiTableColumnFlags_WidthStretch, 3.0f);
+				ImGui::TableSetupColumn("Last (ms)");
+				ImGui::TableSetupColumn("Mean (ms)");
+				ImGui::TableSetupColumn("p99 (ms)");
+				ImGui::TableSetupColumn("Max (ms)");
+				ImGui::TableHeadersRow();
+
+				for (const ScopeTiming& timing : GetScopeTimings())
+				{
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();	ImGui::TextUnformatted(timing.name); ImGui::SameLine(); ImGui::TextDisabled("(%s)", timing.kind);
+					ImGui::TableNextColumn();	ImGui::Text("%.3f", timing.lastMs);
+					ImGui::TableNextColumn();	ImGui::Text("%.3f", timing.meanMs);
+					ImGui::TableNextColumn();	ImGui::Text("%.3f", timing.p99Ms);
+					ImGui::TableNextColumn();	ImGui::Text("%.3f", timing.maxMs);
+				}
+				ImGui::EndTable();
+			}
+		}
+		ImGui::End();
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v)
+
+	inline void BeginTimingScope(const std::string& name)										{ detail::BeginTimedScope(detail::Timings().scopes, detail::InternName(name.c_str())); }
+	inline void EndTimingScope()																{ detail::EndTimedScope(detail::Timings().scopes); }
+	inline sol::table GetScopeTimingsTable(sol::this_state s)
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value);
+		sol::state_view lua{ s };
+		const std::vector<ScopeTiming> timings{ GetScopeTimings() };
+		sol::table result{ lua.create_table(static_cast<int>(timings.size()), 0) };
+		for (std::size_t i{}; i < timings.size(); i++)
+		{
+			const ScopeTiming& timing{ timings[i] };
+			result[i + 1] = lua.create_table_with(
+				"name", timing.name,
+				"kind", timing.kind,
+				"lastMs", timing.lastMs,
+				"meanMs", timing.meanMs,
+				"p99Ms", timing.p99Ms,
+				"maxMs", timing.maxMs,
+				"samples", timing.samples
+			);
+		}
+		return result;
+	}
+	inline void ShowScopeTimingsWindow()														{ ShowScopeTimingsWindow(nullptr); }
+	inline bool ShowScopeTimingsWindow(bool open)												{ if (open) ShowScopeTimingsWindow(&open); return open; }
+#endif
+#pragma endregion Scope Timing
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+#pragma region Binding Statistics
+#ifdef SOL_IMGUI_ENABLE_BINDING_STATS	// Define SOL_IMGUI_ENABLE_BINDING_STATS to count calls and Lua <-> C++ conversions per binding
+	struct BindingStats
+	{
+		const char*	name{};
+		std::size_t	calls{};
+		std::size_t	strings{};			// string arguments converted to std::string
+		std::size_t	stringBytes{};
+		std::size_t	tablesRead{};		// table arguments
+		std::size_t	tableElements{};	// array length of those tables, an upper bound of the elements read
+		std::size_t	tablesCreated{};	// table results, e.g. the ones returned by DragFloat3
+	};
+
+	namespace detail
+	{
+		struct BindingStatsState
+		{
+			std::unordered_map<const char*, BindingStats>	frame;
+			std::unordered_map<const char*, BindingStats>	lastFrame;
+		};
+		inline BindingStatsState& BindingCounters()											{ static thread_local BindingStatsState state; return state; }
 
-		return std::make_tuple(float3, used);
+		// Arguments sit at [1, top] before the call, results at [1, top] after it
+		inline void CountArguments(lua_State* L, BindingStats& stats)
+		{
+			stats.calls++;
+			for (int i{ 1 }, top{ lua_gettop(L) }; i <= top; i++)
+			{
+				switch (lua_type(L, i))
+				{
+				case LUA_TSTRING:
+				{
+					std::size_t length{};
+					lua_tolstring(L, i, &length);
+					stats.strings++;
+					stats.stringBytes += length;
+					break;
+				}
+				case LUA_TTABLE:
+					stats.tablesRead++;
+					stats.tableElements += lua_rawlen(L, i);
+					break;
+				}
+			}
+		}
+		inline void CountResults(lua_State* L, BindingStats& stats)
+		{
+			for (int i{ 1 }, top{ lua_gettop(L) }; i <= top; i++)
+				if (lua_type(L, i) == LUA_TTABLE) stats.tablesCreated++;
+		}
+		inline void RollBindingStats()
+		{
+			auto& counters{ BindingCounters() };
+			std::swap(counters.lastFrame, counters.frame);
+			counters.frame.clear();
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed);
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+	// Bindings of the last frame on this thread, most called first. topN <= 0 returns all of them.
+	inline std::vector<BindingStats> GetBindingStats(int topN)
+	{
+		std::vector<BindingStats> result;
+		for (const auto& [name, stats] : detail::BindingCounters().lastFrame)
+			result.push_back(stats);
+		std::sort(result.begin(), result.end(), [](const BindingStats& a, const BindingStats& b) { return a.calls > b.calls; });
+		if (topN > 0 && result.size() > static_cast<std::size_t>(topN))
+			result.resize(topN);
+		return result;
+	}
 
-		return std::make_tuple(float3, used);
+	inline std::string DumpBindingStats(int topN)
+	{
+		std::ostringstream out;
+		out << "binding                          calls  strings  str bytes  tables read  elements  tables created\n";
+		for (const BindingStats& stats : GetBindingStats(topN))
+		{
+			char line[256];
+			std::snprintf(line, sizeof(line), "%-30s %7zu %8zu %10zu %12zu %9zu %15zu\n",
+				stats.name, stats.calls, stats.strings, stats.stringBytes, stats.tablesRead, stats.tableElements, stats.tablesCreated);
+			out << line;
+		}
+		return out.str();
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min)
+
+	inline sol::table GetBindingStatsTable(sol::this_state s, sol::optional<int> topN)
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min);
+		sol::state_view lua{ s };
+		const std::vector<BindingStats> bindings{ GetBindingStats(topN.value_or(0)) };
+		sol::table result{ lua.create_table(static_cast<int>(bindings.size()), 0) };
+		for (std::size_t i{}; i < bindings.size(); i++)
+		{
+			const BindingStats& stats{ bindings[i] };
+			result[i + 1] = lua.create_table_with(
+				"name", stats.name,
+				"calls", stats.calls,
+				"strings", stats.strings,
+				"stringBytes", stats.stringBytes,
+				"tablesRead", stats.tablesRead,
+				"tableElements", stats.tableElements,
+				"tablesCreated", stats.tablesCreated
+			);
+		}
+		return result;
+	}
+#endif
+#pragma endregion Binding Statistics
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+#pragma region JSON Output
+#ifdef SOL_IMGUI_JSON_OUTPUT
+	namespace detail
+	{
+		inline void AppendJsonString(std::string& out, const std::string& text)
+		{
+			out += '"';
+			for (const char c : text)
+			{
+				switch (c)
+				{
+				case '"':	out += "\\\"";	break;
+				case '\\':	out += "\\\\";	break;
+				case '\n':	out += "\\n";	break;
+				case '\t':	out += "\\t";	break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20)
+					{
+						char escaped[8];
+						std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+						out += escaped;
+					}
+					else out += c;
+				}
+			}
+			out += '"';
+		}
+	}
+#endif
+#pragma endregion JSON Output
 
-		return std::make_tuple(float3, used);
+#pragma region Hook Chaining
+#ifdef SOL_IMGUI_CHAIN_HOOKS
+	namespace detail
+	{
+		// A hook installed in front of the one a state already has. The state counts at the gcd of both count intervals,
+		// and each hook is called once its own interval has elapsed, so neither sees its instructions counted at the other's rate.
+		struct ChainedHook
+		{
+			lua_Hook	hook{};			// the hook found at Install, still called
+			int			mask{};
+			int			count{};
+			int			installedMask{};
+			int			step{};			// instructions between two count events of the installed hook
+			int			ownElapsed{};
+			int			chainedElapsed{};
+
+			void Install(lua_State* L, lua_Hook own, int interval)
+			{
+				hook = lua_gethook(L);
+				mask = lua_gethookmask(L);
+				count = lua_gethookcount(L);
+				const bool chainedCount{ hook && (mask & LUA_MASKCOUNT) && count > 0 };
+				step = chainedCount ? std::gcd(interval, count) : interval;
+				installedMask = LUA_MASKCOUNT | (hook ? mask & ~LUA_MASKCOUNT : 0);
+				ownElapsed = chainedElapsed = 0;
+				lua_sethook(L, own, installedMask, step);
+			}
+			void Restore(lua_State* L) const													{ lua_sethook(L, hook, mask, count); }
+
+			// Call first in the installed hook: forwards the event to the chained hook when it is due for it,
+			// and returns whether interval instructions elapsed for the installed hook
+			bool Dispatch(lua_State* L, lua_Debug* ar, int interval)
+			{
+				if (ar->event != LUA_HOOKCOUNT)
+				{
+					if (hook) hook(L, ar);
+					return false;
+				}
+				if (hook && (mask & LUA_MASKCOUNT) && (chainedElapsed += step) >= count)
+				{
+					chainedElapsed = 0;
+					hook(L, ar);
+				}
+				if ((ownElapsed += step) < interval) return false;
+				ownElapsed = 0;
+				return true;
+			}
+		};
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+#endif
+#pragma endregion Hook Chaining
+
+#pragma region Sampling Profiler
+#ifdef SOL_IMGUI_ENABLE_SAMPLING_PROFILER	// Define SOL_IMGUI_ENABLE_SAMPLING_PROFILER to sample Lua call stacks with a count hook
+	struct ProfileNode
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max);
+		std::string					name;
+		std::size_t					samples{};	// inclusive
+		std::size_t					self{};
+		std::vector<ProfileNode>	children{};
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+		ProfileNode& Child(const std::string& childName)
+		{
+			for (ProfileNode& child : children)
+				if (child.name == childName) return child;
+			return children.emplace_back(ProfileNode{ childName });
+		}
+	};
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	// Samples the Lua call stack at a fixed rate. The count hook fires every instructionInterval VM instructions and only
+	// walks the stack once the sampling period has elapsed, which keeps the overhead low between samples.
+	// Stacks are rooted at the ImGui window that was open when the sample was taken.
+	class SamplingProfiler
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+	public:
+		static constexpr const char* RegistryKey = "sol_ImGui.SamplingProfiler";
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+		explicit SamplingProfiler(sol::state_view lua, double sampleRateHz = 1000.0, int instructionInterval = 1000, int maxDepth = 64)
+			: L(lua.lua_state()),
+			period(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / sampleRateHz))),
+			instructionInterval(instructionInterval), maxDepth(maxDepth)
+		{
+			lua_pushlightuserdata(L, this);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		~SamplingProfiler()
+		{
+			Stop();
+			lua_pushnil(L);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		SamplingProfiler(const SamplingProfiler&) = delete;
+		SamplingProfiler& operator=(const SamplingProfiler&) = delete;
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		void Start()
+		{
+			if (running) return;
+			nextSample = Clock::now() + period;
+			chain.Install(L, Hook, instructionInterval);
+			running = true;
+		}
+		// Puts back the hook Start found, unless another one replaced the profiler's since
+		void Stop()
+		{
+			if (!running) return;
+			if (lua_gethook(L) == Hook) chain.Restore(L);
+			chain = {};
+			running = false;
+		}
+		bool IsRunning() const																	{ return running; }
+		void Reset()																			{ root = ProfileNode{ "all" }; }
+		const ProfileNode& GetRoot() const														{ return root; }
+		double GetSamplePeriodMs() const														{ return std::chrono::duration<double, std::milli>(period).count(); }
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+		// One "frame;frame;frame count" line per stack, the format of flamegraph.pl and most flame graph viewers
+		std::string ExportFolded() const
+		{
+			std::string out;
+			std::string path;
+			std::function<void(const ProfileNode&)> visit = [&](const ProfileNode& node) {
+				const std::size_t length{ path.size() };
+				if (!path.empty()) path += ';';
+				path += node.name;
+				if (node.self) out += path + ' ' + std::to_string(node.self) + '\n';
+				for (const ProfileNode& child : node.children) visit(child);
+				path.resize(length);
+			};
+			for (const ProfileNode& child : root.children) visit(child);
+			return out;
+		}
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value);
+		// Sampled profile in the speedscope file format (https://www.speedscope.app)
+		std::string ExportSpeedscope() const
+		{
+			std::vector<const std::string*> frames;
+			std::unordered_map<std::string, std::size_t> frameIndices;
+			std::string samples, weights;
+			std::vector<std::size_t> stack;
+			const double periodMs{ GetSamplePeriodMs() };
+
+			std::function<void(const ProfileNode&)> visit = [&](const ProfileNode& node) {
+				const auto [it, inserted]{ frameIndices.emplace(node.name, frames.size()) };
+				if (inserted) frames.push_back(&it->first);
+				stack.push_back(it->second);
+				if (node.self)
+				{
+					if (!samples.empty()) { samples += ','; weights += ','; }
+					samples += '[';
+					for (std::size_t i{}; i < stack.size(); i++)
+						samples += (i ? "," : "") + std::to_string(stack[i]);
+					samples += ']';
+					weights += std::to_string(node.self * periodMs);
+				}
+				for (const ProfileNode& child : node.children) visit(child);
+				stack.pop_back();
+			};
+			for (const ProfileNode& child : root.children) visit(child);
+
+			std::string out{ "{\"$schema\":\"https://www.speedscope.app/file-format-schema.json\",\"shared\":{\"frames\":[" };
+			for (std::size_t i{}; i < frames.size(); i++)
+			{
+				out += i ? ",{\"name\":" : "{\"name\":";
+				detail::AppendJsonString(out, *frames[i]);
+				out += '}';
+			}
+			out += "]},\"profiles\":[{\"type\":\"sampled\",\"name\":\"Lua UI\",\"unit\":\"milliseconds\",\"startValue\":0,\"endValue\":";
+			out += std::to_string(root.samples * periodMs);
+			out += ",\"samples\":[" + samples + "],\"weights\":[" + weights + "]}]}";
+			return out;
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Icicle graph of the collected samples drawn with the window's ImDrawList, root at the top
+		void ShowFlameGraphWindow(bool* open)
+		{
+			if (ImGui::Begin("Lua Flame Graph", open))
+			{
+				ImGui::Text("%zu samples (%.2f ms period)", root.samples, GetSamplePeriodMs());
+				ImGui::SameLine();
+				if (ImGui::SmallButton(running ? "Stop" : "Start")) running ? Stop() : Start();
+				ImGui::SameLine();
+				if (ImGui::SmallButton("Reset")) Reset();
+
+				if (root.samples)
+				{
+					const ImVec2 origin{ ImGui::GetCursorScreenPos() };
+					const float width{ ImGui::GetContentRegionAvail().x };
+					const float rowHeight{ ImGui::GetTextLineHeightWithSpacing() };
+					int depth{};
+					DrawNode(ImGui::GetWindowDrawList(), root, origin.x, origin.y, width, rowHeight, 0, depth);
+					ImGui::Dummy({ width, rowHeight * (depth + 1) });
+				}
+			}
+			ImGui::End();
+		}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed);
+		static SamplingProfiler* From(lua_State* L)
+		{
+			lua_getfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			auto* profiler{ static_cast<SamplingProfiler*>(lua_touserdata(L, -1)) };
+			lua_pop(L, 1);
+			return profiler;
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+	private:
+		using Clock = std::chrono::steady_clock;
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min);
+		static void Hook(lua_State* L, lua_Debug* ar)
+		{
+			SamplingProfiler* self{ From(L) };
+			if (!self) return;
+			if (!self->chain.Dispatch(L, ar, self->instructionInterval)) return;
+
+			const auto now{ Clock::now() };
+			if (now < self->nextSample) return;
+			self->nextSample = now + self->period;
+			self->Sample(L);
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		void Sample(lua_State* thread)
+		{
+			labels.clear();
+			lua_Debug ar{};
+			for (int level{}; level < maxDepth && lua_getstack(thread, level, &ar); level++)
+			{
+				lua_getinfo(thread, "Snl", &ar);
+				labels.push_back(FrameLabel(ar));
+			}
+
+			const char* window{ detail::CurrentWindow() };
+			ProfileNode* node{ &root.Child(window ? window : "<no window>") };
+			root.samples++;
+			node->samples++;
+			for (auto it{ labels.rbegin() }; it != labels.rend(); ++it)
+			{
+				node = &node->Child(*it);
+				node->samples++;
+			}
+			node->self++;
+		}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max);
+		static std::string FrameLabel(const lua_Debug& ar)
+		{
+			char label[256];
+			if (*ar.what == 'C')		std::snprintf(label, sizeof(label), "%s [C]", ar.name ? ar.name : "?");
+			else if (*ar.what == 'm')	std::snprintf(label, sizeof(label), "main chunk %s:%d", ar.short_src, ar.currentline);
+			else						std::snprintf(label, sizeof(label), "%s %s:%d", ar.name ? ar.name : "?", ar.short_src, ar.currentline);
+
+			std::string result{ label };
+			std::replace(result.begin(), result.end(), ';', ':');	// ';' separates frames in the folded format
+			return result;
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		void DrawNode(ImDrawList* drawList, const ProfileNode& node, float x, float top, float width, float rowHeight, int depth, int& deepest) const
+		{
+			deepest = std::max(deepest, depth);
+			const ImVec2 min{ x, top + depth * rowHeight };
+			const ImVec2 max{ x + width, min.y + rowHeight - 1.0f };
+
+			const std::size_t hash{ std::hash<std::string>{}(node.name) };
+			drawList->AddRectFilled(min, max, IM_COL32(200 + hash % 55, 80 + (hash >> 8) % 120, 40 + (hash >> 16) % 40, 255));
+			if (width > 8.0f)
+			{
+				drawList->PushClipRect(min, max, true);
+				drawList->AddText({ min.x + 2.0f, min.y }, IM_COL32_BLACK, node.name.c_str());
+				drawList->PopClipRect();
+			}
+			if (ImGui::IsMouseHoveringRect(min, max))
+				ImGui::SetTooltip("%s\n%zu samples (%.1f%%)", node.name.c_str(), node.samples, 100.0 * node.samples / root.samples);
+
+			float childX{ x };
+			for (const ProfileNode& child : node.children)
+			{
+				const float childWidth{ width * child.samples / node.samples };
+				if (childWidth >= 1.0f)
+					DrawNode(drawList, child, childX, top, childWidth, rowHeight, depth + 1, deepest);
+				childX += childWidth;
+			}
+		}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		lua_State*					L;
+		Clock::duration				period;
+		Clock::time_point			nextSample{};
+		int							instructionInterval;
+		int							maxDepth;
+		bool						running{};
+		detail::ChainedHook			chain;		// hook installed before Start, still called
+		ProfileNode					root{ "all" };
+		std::vector<std::string>	labels;		// scratch buffer reused by every sample
+	};
+
+	inline void ShowFlameGraphWindow(sol::this_state s)										{ if (SamplingProfiler* profiler{ SamplingProfiler::From(s) }) profiler->ShowFlameGraphWindow(nullptr); }
+	inline bool ShowFlameGraphWindow(sol::this_state s, bool open)							{ if (SamplingProfiler* profiler{ SamplingProfiler::From(s) }; profiler && open) profiler->ShowFlameGraphWindow(&open); return open; }
+#endif
+#pragma endregion Sampling Profiler
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+#pragma region Trace Zones
+#ifdef SOL_IMGUI_ENABLE_TRACE_ZONES	// Define SOL_IMGUI_ENABLE_TRACE_ZONES to record zones flushable to Chrome Trace Event JSON
+	#ifndef SOL_IMGUI_TRACE_BUFFER_SIZE
+		#define SOL_IMGUI_TRACE_BUFFER_SIZE 16384	// completed zones buffered per thread between flushes, must be a power of two
+	#endif
+	// Define these to forward zones to another profiler as well (e.g. Tracy's C API), they are always called in balanced pairs
+	#ifndef SOL_IMGUI_TRACE_ZONE_BEGIN
+		#define SOL_IMGUI_TRACE_ZONE_BEGIN(name)
+	#endif
+	#ifndef SOL_IMGUI_TRACE_ZONE_END
+		#define SOL_IMGUI_TRACE_ZONE_END()
+	#endif
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, int flags)
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
-
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		struct TraceEvent
+		{
+			const char*	name;
+			double		startUs;
+			double		durationUs;
+		};
+
+		// Single producer (the owning thread) / single consumer (the flushing thread) ring of completed zones.
+		// Pushing never blocks, events are dropped when the ring is full.
+		class TraceBuffer
+		{
+		public:
+			explicit TraceBuffer(int threadId) : threadId(threadId) {}
+
+			void Push(const TraceEvent& event)
+			{
+				const std::size_t position{ head.load(std::memory_order_relaxed) };
+				if (position - tail.load(std::memory_order_acquire) == Capacity)
+				{
+					dropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				events[position & (Capacity - 1)] = event;
+				head.store(position + 1, std::memory_order_release);
+			}
+
+			template <typename Consumer>
+			void Drain(Consumer&& consume)
+			{
+				const std::size_t end{ head.load(std::memory_order_acquire) };
+				std::size_t position{ tail.load(std::memory_order_relaxed) };
+				for (; position != end; position++)
+					consume(events[position & (Capacity - 1)]);
+				tail.store(position, std::memory_order_release);
+			}
+
+			bool Empty() const																	{ return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); }
+			int GetThreadId() const																{ return threadId; }
+			std::size_t GetDropped() const														{ return dropped.load(std::memory_order_relaxed); }
+
+		private:
+			static constexpr std::size_t Capacity = SOL_IMGUI_TRACE_BUFFER_SIZE;
+			static_assert((Capacity & (Capacity - 1)) == 0, "SOL_IMGUI_TRACE_BUFFER_SIZE must be a power of two");
+
+			std::array<TraceEvent, Capacity>	events;
+			alignas(64) std::atomic<std::size_t>	head{};
+			alignas(64) std::atomic<std::size_t>	tail{};
+			std::atomic<std::size_t>			dropped{};
+			int									threadId;
+		};
+
+		// Buffers are shared so the ones of exited threads can still be flushed
+		struct TraceRegistry
+		{
+			std::mutex									mutex;
+			std::vector<std::shared_ptr<TraceBuffer>>	buffers;
+			int											nextThreadId{ 1 };
+		};
+		inline TraceRegistry& Traces()															{ static TraceRegistry registry; return registry; }
+
+		// A zone begun but not ended yet
+		struct OpenTraceZone
+		{
+			TraceEvent	event;
+			std::size_t	windowDepth;	// window zones open when it began
+		};
+
+		// Window zones and user zones are kept apart, so an unbalanced user zone is never ended by a window's End.
+		// A user zone only ends inside the window it began in, and the ones a window leaves open end with it,
+		// which keeps the zones nested and the forwarded SOL_IMGUI_TRACE_ZONE_BEGIN/END pairs in step.
+		struct TraceThread
+		{
+			std::shared_ptr<TraceBuffer>	buffer;
+			std::vector<OpenTraceZone>		windows;
+			std::vector<OpenTraceZone>		zones;
+		};
+		inline TraceThread& ThisTraceThread()
+		{
+			static thread_local TraceThread thread{ [] {
+				TraceRegistry& registry{ Traces() };
+				std::lock_guard<std::mutex> lock{ registry.mutex };
+				auto buffer{ std::make_shared<TraceBuffer>(registry.nextThreadId++) };
+				registry.buffers.push_back(buffer);
+				return TraceThread{ buffer, {}, {} };
+			}() };
+			return thread;
+		}
 
-		return std::make_tuple(float4, used);
+		// Zones left open by scripts that errored are closed so forwarded profilers stay balanced
+		inline void CloseOpenTraceZones()
+		{
+			TraceThread& thread{ ThisTraceThread() };
+			for (std::size_t i{}; i < thread.windows.size() + thread.zones.size(); i++) { SOL_IMGUI_TRACE_ZONE_END(); }
+			thread.windows.clear();
+			thread.zones.clear();
+		}
 	}
-	inline void DragFloatRange2()																																						{ /* TODO: DragFloatRange2(...) ==> UNSUPPORTED */ }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v)																												{ bool used = ImGui::DragInt(label.c_str(), &v); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed)																								{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min)																						{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max)																			{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max, const std::string& format)												{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max, const std::string& format, int flags)									{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v)
+
+	// Microseconds since the first traced event of the process, the timestamps used in the trace file
+	inline double TraceTimestampUs()
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value);
+		static const auto epoch{ std::chrono::steady_clock::now() };
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - epoch).count();
+	}
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+	namespace detail
+	{
+		inline void BeginTraceZone(std::vector<OpenTraceZone>& stack, const char* name)
+		{
+			SOL_IMGUI_TRACE_ZONE_BEGIN(name);
+			stack.push_back({ { name, TraceTimestampUs(), 0.0 }, ThisTraceThread().windows.size() });
+		}
+		inline void EndTraceZone(std::vector<OpenTraceZone>& stack)
+		{
+			TraceEvent event{ stack.back().event };
+			stack.pop_back();
+			event.durationUs = TraceTimestampUs() - event.startUs;
+			ThisTraceThread().buffer->Push(event);
+			SOL_IMGUI_TRACE_ZONE_END();
+		}
 
-		return std::make_tuple(int2, used);
+		inline void BeginWindowTraceZone(const char* name)										{ BeginTraceZone(ThisTraceThread().windows, name); }
+		inline void EndWindowTraceZone()
+		{
+			TraceThread& thread{ ThisTraceThread() };
+			if (thread.windows.empty()) return;
+			while (!thread.zones.empty() && thread.zones.back().windowDepth == thread.windows.size()) EndTraceZone(thread.zones);
+			EndTraceZone(thread.windows);
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed);
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+	// Also usable from engine code to put native zones on the same timeline. name must stay valid until flushed.
+	inline void TraceZoneBegin(const char* name)												{ detail::BeginTraceZone(detail::ThisTraceThread().zones, name); }
+	// Ends the innermost user zone, unless it began outside the current window
+	inline void TraceZoneEnd()
+	{
+		detail::TraceThread& thread{ detail::ThisTraceThread() };
+		if (!thread.zones.empty() && thread.zones.back().windowDepth == thread.windows.size()) detail::EndTraceZone(thread.zones);
+	}
 
-		return std::make_tuple(int2, used);
+	inline std::size_t GetDroppedTraceEvents()
+	{
+		detail::TraceRegistry& registry{ detail::Traces() };
+		std::lock_guard<std::mutex> lock{ registry.mutex };
+		std::size_t dropped{};
+		for (const auto& buffer : registry.buffers) dropped += buffer->GetDropped();
+		return dropped;
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min)
+
+	// Streams the zones of every thread into a Chrome Trace Event file (chrome://tracing, https://ui.perfetto.dev)
+	class TraceFileSink
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min);
+	public:
+		explicit TraceFileSink(const std::string& path)
+			: file(std::fopen(path.c_str(), "wb"))
+		{
+			if (file) std::fputs("{\"traceEvents\":[\n", file);
+		}
+		~TraceFileSink()
+		{
+			if (!file) return;
+			Flush();
+			std::fputs("\n]}\n", file);
+			std::fclose(file);
+		}
+		TraceFileSink(const TraceFileSink&) = delete;
+		TraceFileSink& operator=(const TraceFileSink&) = delete;
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+		bool IsOpen() const																		{ return file != nullptr; }
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max);
+		// Call from one thread at a time, e.g. once per frame after rendering
+		void Flush()
+		{
+			if (!file) return;
+
+			detail::TraceRegistry& registry{ detail::Traces() };
+			std::vector<std::shared_ptr<detail::TraceBuffer>> buffers;
+			{
+				std::lock_guard<std::mutex> lock{ registry.mutex };
+				buffers = registry.buffers;
+			}
+
+			chunk.clear();
+			for (const auto& buffer : buffers)
+			{
+				const int threadId{ buffer->GetThreadId() };
+				buffer->Drain([&](const detail::TraceEvent& event) {
+					chunk += first ? "{\"name\":" : ",\n{\"name\":";
+					first = false;
+					detail::AppendJsonString(chunk, event.name);
+					char fields[128];
+					std::snprintf(fields, sizeof(fields), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d}", event.startUs, event.durationUs, threadId);
+					chunk += fields;
+				});
+			}
+			std::fwrite(chunk.data(), 1, chunk.size(), file);
+			std::fflush(file);
+
+			// Forget the buffers of threads that exited once they are drained
+			buffers.clear();
+			std::lock_guard<std::mutex> lock{ registry.mutex };
+			registry.buffers.erase(std::remove_if(registry.buffers.begin(), registry.buffers.end(), [](const auto& buffer) {
+				return buffer.use_count() == 1 && buffer->Empty();
+			}), registry.buffers.end());
+		}
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+	private:
+		std::FILE*	file;
+		std::string	chunk;
+		bool		first{ true };
+	};
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	inline void ProfileZoneBegin(const std::string& name)										{ TraceZoneBegin(detail::InternName(name.c_str())); }
+	inline void ProfileZoneEnd()																{ TraceZoneEnd(); }
+
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		class TraceZone
+		{
+		public:
+			explicit TraceZone(const char* name)												{ TraceZoneBegin(name); }
+			~TraceZone()																		{ TraceZoneEnd(); }
+			TraceZone(const TraceZone&) = delete;
+			TraceZone& operator=(const TraceZone&) = delete;
+		};
+	}
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+	// Automatic zone around the heavy wrappers (Combo, ListBox, InputTextMultiline)
+	#define SOL_IMGUI_ZONE(name) const ::sol_ImGui::detail::TraceZone solImGuiZone{ name }
+#else
+	#define SOL_IMGUI_ZONE(name) ((void)0)
+#endif
+#pragma endregion Trace Zones
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format, int flags)
+#pragma region Draw Cost
+#ifdef SOL_IMGUI_ENABLE_DRAW_COST	// Define SOL_IMGUI_ENABLE_DRAW_COST to attribute ImDrawList growth to windows and scripts
+	struct DrawCost
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
-
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+		std::size_t	vertices{};
+		std::size_t	indices{};
+		std::size_t	commands{};
+		std::size_t	textureSwitches{};
+		bool		overBudget{};
+	};
+
+	// A zero limit means unlimited
+	struct DrawBudget
+	{
+		std::size_t	vertices{};
+		std::size_t	indices{};
+		std::size_t	commands{};
+	};
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v)
+	struct DrawCostFrameStats
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value);
+		std::unordered_map<const char*, DrawCost>	windows;	// keyed by interned window name
+		std::unordered_map<const char*, DrawCost>	scripts;	// keyed by interned script name, nullptr when none was set
+	};
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+	using DrawBudgetCallback = std::function<void(const char* window, const char* script, const DrawCost& cost, const DrawBudget& budget)>;
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed)
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed);
+		struct DrawSnapshot
+		{
+			const ImDrawList*	drawList;
+			int					vertices;
+			int					indices;
+			int					commands;
+		};
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		struct DrawCostState
+		{
+			std::vector<DrawSnapshot>						stack;
+			DrawCostFrameStats								frame;
+			DrawCostFrameStats								lastFrame;
+			DrawBudget										defaultBudget;
+			std::unordered_map<const char*, DrawBudget>		budgets;
+			DrawBudgetCallback								callback;
+		};
+		inline DrawCostState& DrawCosts()														{ static thread_local DrawCostState state; return state; }
+
+		inline bool ExceedsBudget(const DrawCost& cost, const DrawBudget& budget)
+		{
+			return (budget.vertices && cost.vertices > budget.vertices)
+				|| (budget.indices && cost.indices > budget.indices)
+				|| (budget.commands && cost.commands > budget.commands);
+		}
 
-		return std::make_tuple(int3, used);
+		// Taken right after Begin, so the window decorations drawn by Begin itself are not charged to the script
+		inline void OpenDrawSnapshot()
+		{
+			const ImDrawList* drawList{ ImGui::GetWindowDrawList() };
+			DrawCosts().stack.push_back({ drawList, drawList->VtxBuffer.Size, drawList->IdxBuffer.Size, drawList->CmdBuffer.Size });
+		}
+		inline void CloseDrawSnapshot(const char* window)
+		{
+			DrawCostState& state{ DrawCosts() };
+			if (state.stack.empty()) return;
+			const DrawSnapshot snapshot{ state.stack.back() };
+			state.stack.pop_back();
+
+			const ImDrawList& drawList{ *snapshot.drawList };
+			DrawCost delta{};
+			delta.vertices = static_cast<std::size_t>(std::max(0, drawList.VtxBuffer.Size - snapshot.vertices));
+			delta.indices = static_cast<std::size_t>(std::max(0, drawList.IdxBuffer.Size - snapshot.indices));
+			delta.commands = static_cast<std::size_t>(std::max(0, drawList.CmdBuffer.Size - snapshot.commands));
+			for (int i{ std::max(1, snapshot.commands) }; i < drawList.CmdBuffer.Size; i++)
+				if (drawList.CmdBuffer[i].TextureId != drawList.CmdBuffer[i - 1].TextureId) delta.textureSwitches++;
+
+			const char* script{ CurrentScript() };
+			for (DrawCost* cost : { &state.frame.windows[window], &state.frame.scripts[script] })
+			{
+				cost->vertices += delta.vertices;
+				cost->indices += delta.indices;
+				cost->commands += delta.commands;
+				cost->textureSwitches += delta.textureSwitches;
+			}
+
+			// Warn once per window and frame
+			DrawCost& windowCost{ state.frame.windows[window] };
+			const auto budget{ state.budgets.find(window) };
+			const DrawBudget& limits{ budget != state.budgets.end() ? budget->second : state.defaultBudget };
+			if (!windowCost.overBudget && ExceedsBudget(windowCost, limits))
+			{
+				windowCost.overBudget = true;
+				if (state.callback) state.callback(window, script, windowCost, limits);
+			}
+		}
+		inline void RollDrawCosts()
+		{
+			DrawCostState& state{ DrawCosts() };
+			std::swap(state.lastFrame, state.frame);
+			state.frame.windows.clear();
+			state.frame.scripts.clear();
+			state.stack.clear();
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min);
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+	inline const DrawCostFrameStats& GetDrawCostStats()											{ return detail::DrawCosts().lastFrame; }
+	inline void SetDefaultDrawBudget(const DrawBudget& budget)									{ detail::DrawCosts().defaultBudget = budget; }
+	inline void SetDrawBudget(const std::string& window, const DrawBudget& budget)				{ detail::DrawCosts().budgets[detail::InternName(window.c_str())] = budget; }
+	inline void SetDrawBudgetCallback(DrawBudgetCallback callback)								{ detail::DrawCosts().callback = std::move(callback); }
 
-		return std::make_tuple(int3, used);
+	inline sol::table GetDrawStats(sol::this_state s)
+	{
+		sol::state_view lua{ s };
+		const DrawCostFrameStats& stats{ GetDrawCostStats() };
+		const auto toTable{ [&lua](const std::unordered_map<const char*, DrawCost>& entries, const char* unnamed) {
+			sol::table table{ lua.create_table(0, static_cast<int>(entries.size())) };
+			for (const auto& [name, cost] : entries)
+				table[name ? name : unnamed] = lua.create_table_with(
+					"vertices", cost.vertices,
+					"indices", cost.indices,
+					"commands", cost.commands,
+					"textureSwitches", cost.textureSwitches,
+					"overBudget", cost.overBudget
+				);
+			return table;
+		} };
+		return lua.create_table_with("windows", toTable(stats.windows, "<none>"), "scripts", toTable(stats.scripts, "<none>"));
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	inline void SetDrawBudget(const std::string& window, int vertices, int indices, int commands)
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max);
-
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
-
-		return std::make_tuple(int3, used);
+		SetDrawBudget(window, DrawBudget{ static_cast<std::size_t>(std::max(0, vertices)), static_cast<std::size_t>(std::max(0, indices)), static_cast<std::size_t>(std::max(0, commands)) });
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+#endif
+#pragma endregion Draw Cost
+
+#pragma region Window Cache
+#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE	// Define SOL_IMGUI_ENABLE_WINDOW_CACHE to refresh static windows below the frame rate, replaying their last draw commands in between
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+		struct CachedDrawCommand
+		{
+			ImVec4					clipRect;
+			ImTextureID				textureId;
+			std::vector<ImDrawVert>	vertices;
+			std::vector<ImDrawIdx>	indices;	// into vertices
+		};
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		struct WindowCache
+		{
+			double							refreshedAt{};
+			int								usedFrame{};
+			bool							valid{};	// commands hold a complete capture
+			ImVec2							position, size, scroll;
+			ImGuiStyle						style;
+			ImVec2							contentMax;	// screen space, where the last item ended
+			std::vector<CachedDrawCommand>	commands;
+		};
+
+		// One per window opened through the hooks, innermost last
+		struct WindowCacheFrame
+		{
+			WindowCache*	cache{};		// nullptr when the window did not opt in
+			bool			recording{};	// the script runs, its draw commands are captured on close
+			bool			cacheable{};	// cleared by anything the replay would not reproduce
+			int				indexStart{};
+		};
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		struct WindowCacheState
+		{
+			std::unordered_map<ImGuiID, WindowCache>		windows;	// keyed by the window's ImGuiID
+			std::vector<WindowCacheFrame>					stack;
+			std::vector<std::string>						invalidated;	// names passed to InvalidateWindow this frame
+			std::vector<std::string>						invalidating;	// names passed last frame, matched against the windows opened this frame
+			double											nextInterval{ -1.0 };	// negative when SetNextWindowRefreshInterval was not called
+		};
+		inline WindowCacheState& WindowCaches()													{ static thread_local WindowCacheState state; return state; }
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		inline bool SameVec2(const ImVec2& a, const ImVec2& b)									{ return a.x == b.x && a.y == b.y; }
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value);
+		inline void ReplayWindowCache(const WindowCache& cache)
+		{
+			ImDrawList* drawList{ ImGui::GetWindowDrawList() };
+			for (const CachedDrawCommand& command : cache.commands)
+			{
+				drawList->PushClipRect({ command.clipRect.x, command.clipRect.y }, { command.clipRect.z, command.clipRect.w });
+				drawList->PushTextureID(command.textureId);
+				drawList->PrimReserve(static_cast<int>(command.indices.size()), static_cast<int>(command.vertices.size()));
+				const unsigned int base{ drawList->_VtxCurrentIdx };
+				for (const ImDrawIdx index : command.indices) drawList->PrimWriteIdx(static_cast<ImDrawIdx>(base + index));
+				for (const ImDrawVert& vertex : command.vertices) drawList->PrimWriteVtx(vertex.pos, vertex.uv, vertex.col);
+				drawList->PopTextureID();
+				drawList->PopClipRect();
+			}
+
+			// Gives the window the content size the skipped items had, so scrollbars and auto-resize stay put
+			ImGui::SetCursorScreenPos(cache.contentMax);
+			ImGui::Dummy({ 0.0f, 0.0f });
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Decides, right after Begin, whether the script runs this frame or the window replays its cached commands
+		inline bool OpenWindowCache(const char* name, bool shouldDraw)
+		{
+			WindowCacheState& state{ WindowCaches() };
+
+			// A window nested in one being captured draws to its own list, which the replay would miss
+			for (WindowCacheFrame& frame : state.stack)
+				if (frame.recording) frame.cacheable = false;
+
+			WindowCacheFrame& frame{ state.stack.emplace_back() };
+			const double interval{ state.nextInterval };
+			state.nextInterval = -1.0;
+			if (interval < 0.0) return shouldDraw;
+
+			// Right after Begin the window's ID stack holds only its own ID, which hashing "" returns unchanged.
+			// Child windows get theirs from the parent, and "Label###id" from its "###id", as ImGui does.
+			WindowCache& cache{ state.windows[ImGui::GetID("")] };
+			cache.usedFrame = ImGui::GetFrameCount();
+			if (!shouldDraw)
+			{
+				cache.valid = false;
+				return false;
+			}
+
+			const ImGuiIO& io{ ImGui::GetIO() };
+			const ImGuiStyle& style{ ImGui::GetStyle() };
+			const ImVec2 position{ ImGui::GetWindowPos() }, size{ ImGui::GetWindowSize() }, scroll{ ImGui::GetScrollX(), ImGui::GetScrollY() };
+			const double now{ ImGui::GetTime() };
+			const bool interacting{ ImGui::IsWindowHovered(ImGuiHoveredFlags_ChildWindows | ImGuiHoveredFlags_AllowWhenBlockedByActiveItem)
+				|| (ImGui::IsWindowFocused(ImGuiFocusedFlags_ChildWindows) && (ImGui::IsAnyItemActive() || io.WantTextInput || (io.NavActive && io.NavVisible))) };
+			// An invalidated name resolves to this window when it hashes like the window's name in the window's ID scope
+			const ImGuiID nameId{ ImGui::GetID(name) };
+			const bool invalidated{ std::any_of(state.invalidating.begin(), state.invalidating.end(), [nameId](const std::string& other) { return ImGui::GetID(other.c_str()) == nameId; }) };
+			const bool due{ !cache.valid || invalidated || interacting || now - cache.refreshedAt >= interval
+				|| !SameVec2(position, cache.position) || !SameVec2(size, cache.size) || !SameVec2(scroll, cache.scroll)
+				|| std::memcmp(&style, &cache.style, sizeof(ImGuiStyle)) != 0 };
+
+			frame.cache = &cache;
+			if (!due)
+			{
+				ReplayWindowCache(cache);
+				return false;
+			}
+
+			cache.valid = false;
+			cache.refreshedAt = now;
+			cache.position = position;
+			cache.size = size;
+			cache.scroll = scroll;
+			std::memcpy(&cache.style, &style, sizeof(ImGuiStyle));
+			frame.recording = true;
+			frame.cacheable = true;
+			frame.indexStart = ImGui::GetWindowDrawList()->IdxBuffer.Size;
+			return true;
+		}
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed);
+		// Right before End: captures what the script drew since OpenWindowCache
+		inline void CloseWindowCache()
+		{
+			WindowCacheState& state{ WindowCaches() };
+			if (state.stack.empty()) return;
+			const WindowCacheFrame frame{ state.stack.back() };
+			state.stack.pop_back();
+			if (!frame.recording) return;
+
+			WindowCache& cache{ *frame.cache };
+			cache.commands.clear();
+			if (!frame.cacheable) return;
+
+			const ImDrawList& drawList{ *ImGui::GetWindowDrawList() };
+			ImVec2 contentMax{ ImGui::GetCursorScreenPos() };
+			contentMax.y -= ImGui::GetStyle().ItemSpacing.y;
+			for (const ImDrawCmd& command : drawList.CmdBuffer)
+			{
+				// The first command may have started before the window contents, when Begin left it open
+				const int first{ std::max(static_cast<int>(command.IdxOffset), frame.indexStart) };
+				const int last{ static_cast<int>(command.IdxOffset + command.ElemCount) };
+				if (first >= last) continue;
+				if (command.UserCallback)
+				{
+					cache.commands.clear();
+					return;
+				}
+
+				unsigned int low{ ~0u }, high{};
+				for (int i = first; i < last; i++)
+				{
+					low = std::min<unsigned int>(low, drawList.IdxBuffer[i]);
+					high = std::max<unsigned int>(high, drawList.IdxBuffer[i]);
+				}
+
+				CachedDrawCommand& cached{ cache.commands.emplace_back() };
+				cached.clipRect = command.ClipRect;
+				cached.textureId = command.TextureId;
+				const ImDrawVert* vertices{ drawList.VtxBuffer.Data + command.VtxOffset };
+				cached.vertices.assign(vertices + low, vertices + high + 1);
+				for (const ImDrawVert& vertex : cached.vertices) contentMax.x = std::max(contentMax.x, vertex.pos.x);
+				cached.indices.reserve(static_cast<std::size_t>(last - first));
+				for (int i = first; i < last; i++) cached.indices.push_back(static_cast<ImDrawIdx>(drawList.IdxBuffer[i] - low));
+			}
+			cache.contentMax = contentMax;
+			cache.valid = true;
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Forgets the windows that were not submitted last frame
+		inline void RollWindowCaches()
+		{
+			WindowCacheState& state{ WindowCaches() };
+			const int frame{ ImGui::GetFrameCount() };
+			for (auto window{ state.windows.begin() }; window != state.windows.end();)
+				window = frame - window->second.usedFrame > 1 ? state.windows.erase(window) : std::next(window);
+			state.stack.clear();
+			state.nextInterval = -1.0;
+			state.invalidating.swap(state.invalidated);
+			state.invalidated.clear();
+		}
+	}
 
-		return std::make_tuple(int4, used);
+	// The next Begin or BeginChild runs its contents at most every seconds, 0 for every frame, unless the window is hovered,
+	// used, moved, resized, scrolled, restyled or invalidated. In between, Begin returns false and the window replays the draw
+	// commands of its last refresh. Call it before Begin on every frame the window should stay cached.
+	inline void SetNextWindowRefreshInterval(float seconds)										{ detail::WindowCaches().nextInterval = std::max(0.0, static_cast<double>(seconds)); }
+	// Refreshes the window next frame, e.g. after the host changed the data it shows. name resolves to the window's ID when
+	// the window opens, so it may be called outside a frame, and "Other label###id" invalidates the window "Label###id".
+	inline void InvalidateWindow(const std::string& name)
+	{
+		std::vector<std::string>& invalidated{ detail::WindowCaches().invalidated };
+		if (std::find(invalidated.begin(), invalidated.end(), name) == invalidated.end()) invalidated.push_back(name);
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min)
+#endif
+#pragma endregion Window Cache
+
+#pragma region Frame Recorder
+#ifdef SOL_IMGUI_ENABLE_RECORDER	// Define SOL_IMGUI_ENABLE_RECORDER to record ImGui.* calls and input per frame for headless replay
+	// Recording layout, native endianness:
+	//	header	"SIGR" u32 version
+	//	'N'		u32 id, u16 length, name bytes			defines a binding name before its first call
+	//	'F'		u32 frame, f32 deltaTime, f32 displaySize[2], f32 mousePos[2], u8 mouseDown bits, f32 wheel, f32 wheelH,
+	//			u16 count, u16 keysDown[count], u16 count, u32 characters[count]
+	//	'C'		u32 id, u8 count, values[count] (arguments), u8 count, values[count] (results)
+	// A value is a u8 RecordedType followed by u8 for booleans, f64 for numbers, u32 length + bytes for strings
+	// and u32 count + values for the array part of tables (nested tables are recorded as nil).
+	enum class RecordedType : unsigned char { Nil, Boolean, Number, String, Table };
+
+	struct RecordedValue
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min);
+		RecordedType				type{ RecordedType::Nil };
+		double						number{};	// 0 or 1 for booleans
+		std::string					string;
+		std::vector<RecordedValue>	elements;
+	};
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+	inline constexpr char RecordingMagic[4]{ 'S', 'I', 'G', 'R' };
+	inline constexpr std::uint32_t RecordingVersion{ 1 };
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	class FrameRecorder;
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max);
-
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		inline FrameRecorder*& ActiveRecorder()													{ static thread_local FrameRecorder* recorder{}; return recorder; }
 
-		return std::make_tuple(int4, used);
+		template <typename T>
+		inline void AppendRaw(std::string& out, T value)										{ out.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+
+	// Records every instrumented ImGui.* call made on the constructing thread, with its arguments and results,
+	// and the input state of each frame. Frames are written out when the next one starts and on destruction.
+	class FrameRecorder
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+	public:
+		explicit FrameRecorder(const std::string& path)
+			: file(std::fopen(path.c_str(), "wb"))
+		{
+			if (!file) return;
+			buffer.append(RecordingMagic, sizeof(RecordingMagic));
+			detail::AppendRaw(buffer, RecordingVersion);
+			detail::ActiveRecorder() = this;
+		}
+		~FrameRecorder()
+		{
+			if (detail::ActiveRecorder() == this) detail::ActiveRecorder() = nullptr;
+			if (!file) return;
+			Flush();
+			std::fclose(file);
+		}
+		FrameRecorder(const FrameRecorder&) = delete;
+		FrameRecorder& operator=(const FrameRecorder&) = delete;
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		bool IsOpen() const																		{ return file != nullptr; }
+		std::uint32_t GetFrameCount() const														{ return frame; }
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		// Call right after ImGui::NewFrame(): records the input state ImGui is using for the frame
+		void NewFrame()
+		{
+			if (!file) return;
+			Flush();
+			const ImGuiIO& io{ ImGui::GetIO() };
+			buffer += 'F';
+			detail::AppendRaw(buffer, frame++);
+			detail::AppendRaw(buffer, io.DeltaTime);
+			detail::AppendRaw(buffer, io.DisplaySize.x);
+			detail::AppendRaw(buffer, io.DisplaySize.y);
+			detail::AppendRaw(buffer, io.MousePos.x);
+			detail::AppendRaw(buffer, io.MousePos.y);
+			unsigned char mouseDown{};
+			for (int button = 0; button < 5; button++)
+				if (io.MouseDown[button]) mouseDown |= static_cast<unsigned char>(1 << button);
+			detail::AppendRaw(buffer, mouseDown);
+			detail::AppendRaw(buffer, io.MouseWheel);
+			detail::AppendRaw(buffer, io.MouseWheelH);
+
+			std::vector<std::uint16_t> keys;
+			for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key++)
+				if (ImGui::IsKeyDown(static_cast<ImGuiKey>(key))) keys.push_back(static_cast<std::uint16_t>(key));
+			detail::AppendRaw(buffer, static_cast<std::uint16_t>(keys.size()));
+			for (const auto key : keys) detail::AppendRaw(buffer, key);
+
+			const int characters{ std::min(io.InputQueueCharacters.Size, 0xFFFF) };
+			detail::AppendRaw(buffer, static_cast<std::uint16_t>(characters));
+			for (int i = 0; i < characters; i++) detail::AppendRaw(buffer, static_cast<std::uint32_t>(io.InputQueueCharacters[i]));
+			recording = true;
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Arguments are kept aside until the call returns, so that a binding raising an error leaves no partial record.
+		// One pending record per binding depth: a call nested in another one, e.g. from a callback, is written after it.
+		void BeginCall(lua_State* L, const char* name)
+		{
+			PendingCall& call{ pending.emplace_back() };
+			if (!recording) return;
+			const auto [it, inserted]{ ids.try_emplace(name, static_cast<std::uint32_t>(ids.size())) };
+			if (inserted)
+			{
+				const std::size_t length{ std::min<std::size_t>(std::char_traits<char>::length(name), 0xFFFF) };
+				buffer += 'N';
+				detail::AppendRaw(buffer, it->second);
+				detail::AppendRaw(buffer, static_cast<std::uint16_t>(length));
+				buffer.append(name, length);
+			}
+			call.offset = buffer.size();
+			call.record += 'C';
+			detail::AppendRaw(call.record, it->second);
+			WriteValues(call.record, L, 1, lua_gettop(L));
+		}
+		void EndCall(lua_State* L)
+		{
+			if (pending.empty()) return;
+			PendingCall& call{ pending.back() };
+			if (!call.record.empty())
+			{
+				WriteValues(call.record, L, 1, lua_gettop(L));
+				buffer.insert(call.offset, call.record);
+			}
+			pending.pop_back();
+		}
+		void AbortCall()															{ if (!pending.empty()) pending.pop_back(); }
 
-		return std::make_tuple(int4, used);
-	}
-	inline void DragIntRange2()																																							{ /* TODO: DragIntRange2(...) ==> UNSUPPORTED */ }
-	inline void DragScalar()																																							{ /* TODO: DragScalar(...) ==> UNSUPPORTED */ }
-	inline void DragScalarN()																																							{ /* TODO: DragScalarN(...) ==> UNSUPPORTED */ }
+	private:
+		void Flush()
+		{
+			if (buffer.empty()) return;
+			std::fwrite(buffer.data(), 1, buffer.size(), file);
+			buffer.clear();
+		}
+		struct PendingCall
+		{
+			std::string	record;		// empty while not recording
+			std::size_t	offset{};	// where the record goes in buffer, ahead of the calls nested in it
+		};
 
-	// Widgets: Sliders
-	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max)																				{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max, const std::string& format)													{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max, const std::string& format, int flags)										{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max);
+		static void WriteValues(std::string& out, lua_State* L, int first, int last)
+		{
+			const int count{ std::clamp(last - first + 1, 0, 0xFF) };
+			detail::AppendRaw(out, static_cast<unsigned char>(count));
+			for (int i = 0; i < count; i++) WriteValue(out, L, first + i, true);
+		}
+		static void WriteValue(std::string& out, lua_State* L, int index, bool allowTable)
+		{
+			switch (lua_type(L, index))
+			{
+			case LUA_TBOOLEAN:
+				detail::AppendRaw(out, RecordedType::Boolean);
+				detail::AppendRaw(out, static_cast<unsigned char>(lua_toboolean(L, index)));
+				break;
+			case LUA_TNUMBER:
+				detail::AppendRaw(out, RecordedType::Number);
+				detail::AppendRaw(out, static_cast<double>(lua_tonumber(L, index)));
+				break;
+			case LUA_TSTRING:
+			{
+				std::size_t length{};
+				const char* string{ lua_tolstring(L, index, &length) };
+				detail::AppendRaw(out, RecordedType::String);
+				detail::AppendRaw(out, static_cast<std::uint32_t>(length));
+				out.append(string, length);
+				break;
+			}
+			case LUA_TTABLE:
+				if (allowTable)
+				{
+					const int table{ lua_absindex(L, index) };
+					const auto count{ static_cast<std::uint32_t>(lua_rawlen(L, table)) };
+					detail::AppendRaw(out, RecordedType::Table);
+					detail::AppendRaw(out, count);
+					for (std::uint32_t i = 1; i <= count; i++)
+					{
+						lua_rawgeti(L, table, static_cast<lua_Integer>(i));
+						WriteValue(out, L, -1, false);
+						lua_pop(L, 1);
+					}
+					break;
+				}
+				[[fallthrough]];
+			default:
+				detail::AppendRaw(out, RecordedType::Nil);
+				break;
+			}
+		}
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		std::FILE*										file;
+		std::string										buffer;
+		std::vector<PendingCall>						pending;
+		std::unordered_map<const char*, std::uint32_t>	ids;	// keyed by interned binding name
+		std::uint32_t									frame{};
+		bool											recording{};
+	};
+#endif
+#pragma endregion Frame Recorder
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+#pragma region Stack Tracking
+#ifdef SOL_IMGUI_TRACK_STACKS
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max, format.c_str());
+		enum class StackKind : unsigned char
+		{
+			Window, Child, ID, StyleColor, StyleVar, Font, Group, ItemWidth, TextWrapPos, Tree,
+			Combo, ListBox, MenuBar, MainMenuBar, Menu, Tooltip, Popup, TabBar, TabItem, ClipRect
+		};
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		struct StackEntry
+		{
+			StackKind	kind;
+			std::string	origin;		// "script.lua:42" of the push, only recorded by the validated profile
+		};
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		// ImGui stacks opened through the wrappers, in the order they were opened
+		inline std::vector<StackEntry>& Stacks()												{ static thread_local std::vector<StackEntry> stacks; return stacks; }
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+	#ifdef SOL_IMGUI_VALIDATED
+		inline const char* StackOpener(StackKind kind)
+		{
+			static constexpr const char* openers[]
+			{
+				"Begin", "BeginChild", "PushID", "PushStyleColor", "PushStyleVar", "PushFont", "BeginGroup", "PushItemWidth", "PushTextWrapPos", "TreeNode/TreePush",
+				"BeginCombo", "BeginListBox", "BeginMenuBar", "BeginMainMenuBar", "BeginMenu", "BeginTooltip", "BeginPopup", "BeginTabBar", "BeginTabItem", "PushClipRect"
+			};
+			return openers[static_cast<int>(kind)];
+		}
+		inline const char* StackCloser(StackKind kind)
+		{
+			static constexpr const char* closers[]
+			{
+				"End", "EndChild", "PopID", "PopStyleColor", "PopStyleVar", "PopFont", "EndGroup", "PopItemWidth", "PopTextWrapPos", "TreePop",
+				"EndCombo", "EndListBox", "EndMenuBar", "EndMainMenuBar", "EndMenu", "EndTooltip", "EndPopup", "EndTabBar", "EndTabItem", "PopClipRect"
+			};
+			return closers[static_cast<int>(kind)];
+		}
+		// Kinds that open a window of their own, and kinds ImGui keeps globally rather than per window
+		inline bool IsWindowStack(StackKind kind)
+		{
+			return kind == StackKind::Window || kind == StackKind::Child || kind == StackKind::Combo || kind == StackKind::ListBox || kind == StackKind::MainMenuBar ||
+				kind == StackKind::Menu || kind == StackKind::Tooltip || kind == StackKind::Popup;
+		}
+		inline bool IsGlobalStack(StackKind kind)												{ return kind == StackKind::StyleColor || kind == StackKind::StyleVar || kind == StackKind::Font; }
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max);
+		// Source and line of the innermost Lua function calling into the bindings
+		inline std::string LuaLocation()
+		{
+			lua_State* L{ Scopes().lua };
+			lua_Debug ar{};
+			for (int level = 0; L && lua_getstack(L, level, &ar); level++)
+				if (lua_getinfo(L, "Sl", &ar) && ar.currentline > 0) return std::string(ar.short_src) + ":" + std::to_string(ar.currentline);
+			return "<C++>";
+		}
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[3]
-		});
+		// Raised as a Lua error carrying a traceback to the offending line when called from Lua
+		[[noreturn]] inline void StackError(const std::string& message)
+		{
+			lua_State* L{ Scopes().lua };
+			if (!L) throw sol::error(message);
+			luaL_traceback(L, L, message.c_str(), 1);
+			std::string traceback{ lua_tostring(L, -1) };
+			lua_pop(L, 1);
+			throw sol::error(traceback);
+		}
+	#endif
 
-		return std::make_tuple(float3, used);
+		inline void PushStack(StackKind kind)
+		{
+		#ifdef SOL_IMGUI_VALIDATED
+			Stacks().push_back({ kind, LuaLocation() });
+		#else
+			Stacks().push_back({ kind, {} });
+		#endif
+		}
+		inline bool PushStackIf(bool opened, StackKind kind)									{ if (opened) PushStack(kind); return opened; }
+
+		// Removes the most recent entries of that kind, as ImGui keeps one stack per kind. The validated profile
+		// checks them first, so a mismatched pop raises an error instead of reaching ImGui.
+		inline void PopStack(StackKind kind, int count)
+		{
+			auto& stacks{ Stacks() };
+			if (count <= 0) return;
+		#ifdef SOL_IMGUI_VALIDATED
+			auto match{ stacks.end() };
+			for (int remaining = count; remaining > 0 && match != stacks.begin();)
+				if ((--match)->kind == kind) remaining--;
+			if (match == stacks.end() || std::count_if(match, stacks.end(), [kind](const StackEntry& entry) { return entry.kind == kind; }) < count)
+				StackError(std::string(StackCloser(kind)) + "() without a matching " + StackOpener(kind) + "()");
+			for (auto inner{ stacks.end() }; !IsGlobalStack(kind) && --inner != match;)
+				if (inner->kind != kind && (IsWindowStack(inner->kind) || (IsWindowStack(kind) && !IsGlobalStack(inner->kind))))
+					StackError(std::string(StackCloser(kind)) + "() while " + StackOpener(inner->kind) + "() from " + inner->origin + " is still open, call " + StackCloser(inner->kind) + "() first");
+		#endif
+			for (auto it = stacks.end(); count > 0 && it != stacks.begin();)
+			{
+				if ((--it)->kind != kind) continue;
+				it = stacks.erase(it);
+				count--;
+			}
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max, format.c_str());
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[3]
-		});
+	#define SOL_IMGUI_STACK_PUSH(kind)				::sol_ImGui::detail::PushStack(::sol_ImGui::detail::StackKind::kind)
+	#define SOL_IMGUI_STACK_PUSH_IF(opened, kind)	::sol_ImGui::detail::PushStackIf((opened), ::sol_ImGui::detail::StackKind::kind)
+	#define SOL_IMGUI_STACK_POP(kind, count)		::sol_ImGui::detail::PopStack(::sol_ImGui::detail::StackKind::kind, (count))
+#else
+	#define SOL_IMGUI_STACK_PUSH(kind)				((void)0)
+	#define SOL_IMGUI_STACK_PUSH_IF(opened, kind)	(opened)
+	#define SOL_IMGUI_STACK_POP(kind, count)		((void)0)
+#endif
 
-		return std::make_tuple(float3, used);
+#ifdef SOL_IMGUI_VALIDATED
+	// Call before ImGui::Render() to list what the scripts left open this frame and where they opened it.
+	// Returns an empty string when every stack is balanced.
+	inline std::string ValidateStacks()
+	{
+		std::string report;
+		for (const auto& entry : detail::Stacks())
+			report += std::string(detail::StackOpener(entry.kind)) + "() from " + entry.origin + " was never closed with " + detail::StackCloser(entry.kind) + "()\n";
+		return report;
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, int flags)
+#endif
+#pragma endregion Stack Tracking
+
+#pragma region Instrumentation Hooks
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		inline void OnWindowBegin([[maybe_unused]] const char* name)
+		{
+		#ifdef SOL_IMGUI_TRACK_SCOPES
+			Scopes().windows.push_back(InternName(name));
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+			BeginTimedScope(Timings().windows, Scopes().windows.back());
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_TRACE_ZONES
+			BeginWindowTraceZone(Scopes().windows.back());
+		#endif
+		}
+		// Called right after ImGui::Begin/BeginChild and right before ImGui::End/EndChild, while the window is current.
+		// OnWindowOpened returns whether the caller should submit the window contents.
+		inline bool OnWindowOpened([[maybe_unused]] const char* name, bool shouldDraw)
+		{
+		#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+			OpenDrawSnapshot();
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+			shouldDraw = OpenWindowCache(name, shouldDraw);
+		#endif
+			return shouldDraw;
+		}
+		inline void OnWindowClosing()
+		{
+		#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+			CloseWindowCache();
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+			CloseDrawSnapshot(CurrentWindow());
+		#endif
+		}
+		inline void OnWindowEnd()
+		{
+		#ifdef SOL_IMGUI_ENABLE_TRACE_ZONES
+			EndWindowTraceZone();
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+			EndTimedScope(Timings().windows);
+		#endif
+		#ifdef SOL_IMGUI_TRACK_SCOPES
+			auto& windows{ Scopes().windows };
+			if (!windows.empty()) windows.pop_back();
+		#endif
+		}
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[3]
-		});
+	#ifdef SOL_IMGUI_INSTRUMENT_BINDINGS
+		class BindingScope
+		{
+		public:
+			BindingScope(lua_State* L, const char* name) : previous(Scopes().binding), previousLua(Scopes().lua)	{ Scopes().binding = name; Scopes().lua = L; }
+			~BindingScope()																		{ Scopes().binding = previous; Scopes().lua = previousLua; }
+			BindingScope(const BindingScope&) = delete;
+			BindingScope& operator=(const BindingScope&) = delete;
+
+		private:
+			const char* previous;
+			lua_State*	previousLua;
+		};
+
+		// Upvalue 1 is the original binding, upvalue 2 its interned name as light userdata
+		inline int InstrumentedBinding(lua_State* L)
+		{
+			const char* name{ static_cast<const char*>(lua_touserdata(L, lua_upvalueindex(2))) };
+		#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+			BindingStats& stats{ BindingCounters().frame[name] };
+			stats.name = name;
+			CountArguments(L, stats);
+		#endif
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max);
+		#ifdef SOL_IMGUI_ENABLE_RECORDER
+			FrameRecorder* recorder{ ActiveRecorder() };
+			if (recorder) recorder->BeginCall(L, name);
+		#endif
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+			// Protected, so that the scope is restored before the error unwinds past this frame: lua_error
+			// longjmps over C++ destructors when Lua is built as C
+			int status;
+			{
+				BindingScope scope{ L, name };
+				lua_pushvalue(L, lua_upvalueindex(1));
+				lua_insert(L, 1);
+				status = lua_pcall(L, lua_gettop(L) - 1, LUA_MULTRET, 0);
+			}
+			if (status != 0)
+			{
+			#ifdef SOL_IMGUI_ENABLE_RECORDER
+				if (recorder) recorder->AbortCall();
+			#endif
+				return lua_error(L);
+			}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max, format.c_str());
+		#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+			CountResults(L, stats);
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_RECORDER
+			if (recorder) recorder->EndCall(L);
+		#endif
+			return lua_gettop(L);
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Replaces the function stored under name in the table at index by a closure that reports the binding while it runs
+		inline void InstrumentBinding(lua_State* L, int index, const char* name)
+		{
+			const int table{ lua_absindex(L, index) };
+			lua_getfield(L, table, name);
+			lua_pushlightuserdata(L, const_cast<char*>(InternName(name)));
+			lua_pushcclosure(L, InstrumentedBinding, 2);
+			lua_setfield(L, table, name);
+		}
 
-		return std::make_tuple(float4, used);
+		inline void InstrumentBindings(sol::table& ImGui)
+		{
+			std::vector<std::string> names;
+			for (const auto& [key, value] : ImGui)
+				if (key.get_type() == sol::type::string && value.get_type() == sol::type::function)
+					names.push_back(key.as<std::string>());
+
+			lua_State* L{ ImGui.lua_state() };
+			ImGui.push();
+			for (const auto& name : names) InstrumentBinding(L, -1, name.c_str());
+			lua_pop(L, 1);
+		}
+	#endif
+	}
+
+	// Call right after ImGui::NewFrame() when any of the optional instrumentation features is enabled.
+	// Resets the window stack left unbalanced by scripts that errored between Begin and End.
+	inline void NewFrame()
+	{
+	#ifdef SOL_IMGUI_TRACK_SCOPES
+		detail::Scopes().windows.clear();
+	#endif
+	#ifdef SOL_IMGUI_INSTRUMENT_BINDINGS
+		detail::Scopes().binding = nullptr;
+		detail::Scopes().lua = nullptr;
+	#endif
+	#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+		detail::RollScopeTimings();
+	#endif
+	#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+		detail::RollBindingStats();
+	#endif
+	#ifdef SOL_IMGUI_ENABLE_TRACE_ZONES
+		detail::CloseOpenTraceZones();
+	#endif
+	#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+		detail::RollDrawCosts();
+	#endif
+	#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+		detail::RollWindowCaches();
+	#endif
+	#ifdef SOL_IMGUI_TRACK_STACKS
+		detail::Stacks().clear();
+	#endif
+	}
+#pragma endregion Instrumentation Hooks
+
+	// Windows
+	inline bool Begin(const std::string& name)															{ detail::OnWindowBegin(name.c_str()); SOL_IMGUI_STACK_PUSH(Window); return detail::OnWindowOpened(name.c_str(), ImGui::Begin(name.c_str())); }
+	inline std::tuple<bool, bool> Begin(const std::string& name, bool open)
+	{
+		if (!open) return std::make_tuple(false, false);
+
+		detail::OnWindowBegin(name.c_str());
+		SOL_IMGUI_STACK_PUSH(Window);
+		bool shouldDraw = detail::OnWindowOpened(name.c_str(), ImGui::Begin(name.c_str(), &open));
+
+		if(!open)
+		{
+			SOL_IMGUI_STACK_POP(Window, 1);
+			detail::OnWindowClosing();
+			ImGui::End();
+			detail::OnWindowEnd();
+			return std::make_tuple(false, false);
+		}
+		
+		return std::make_tuple(open, shouldDraw);
+	}
+	inline std::tuple<bool, bool> Begin(const std::string& name, bool open, int flags)
+	{
+		if (!open) return std::make_tuple(false, false);
+		detail::OnWindowBegin(name.c_str());
+		SOL_IMGUI_STACK_PUSH(Window);
+		bool shouldDraw = detail::OnWindowOpened(name.c_str(), ImGui::Begin(name.c_str(), &open, static_cast<ImGuiWindowFlags_>(flags)));
+
+		if(!open)
+		{
+			SOL_IMGUI_STACK_POP(Window, 1);
+			detail::OnWindowClosing();
+			ImGui::End();
+			detail::OnWindowEnd();
+			return std::make_tuple(false, false);
+		}
+		
+		return std::make_tuple(open, shouldDraw);
+	}
+	inline void End()																					{ SOL_IMGUI_STACK_POP(Window, 1); detail::OnWindowClosing(); ImGui::End(); detail::OnWindowEnd(); }
+	
+	// Child Windows
+	inline bool BeginChild(const std::string& name)														{ detail::OnWindowBegin(name.c_str()); SOL_IMGUI_STACK_PUSH(Child); return detail::OnWindowOpened(name.c_str(), ImGui::BeginChild(name.c_str())); }
+	inline bool BeginChild(const std::string& name, float sizeX)										{ detail::OnWindowBegin(name.c_str()); SOL_IMGUI_STACK_PUSH(Child); return detail::OnWindowOpened(name.c_str(), ImGui::BeginChild(name.c_str(), { sizeX, 0 })); }
+	inline bool BeginChild(const std::string& name, float sizeX, float sizeY)							{ detail::OnWindowBegin(name.c_str()); SOL_IMGUI_STACK_PUSH(Child); return detail::OnWindowOpened(name.c_str(), ImGui::BeginChild(name.c_str(), { sizeX, sizeY })); }
+	inline bool BeginChild(const std::string& name, float sizeX, float sizeY, int childFlags)			{ detail::OnWindowBegin(name.c_str()); SOL_IMGUI_STACK_PUSH(Child); return detail::OnWindowOpened(name.c_str(), ImGui::BeginChild(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiChildFlags>(childFlags))); }
+	inline bool BeginChild(const std::string& name, float sizeX, float sizeY, int childFlags, int flags){ detail::OnWindowBegin(name.c_str()); SOL_IMGUI_STACK_PUSH(Child); return detail::OnWindowOpened(name.c_str(), ImGui::BeginChild(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiChildFlags>(childFlags), static_cast<ImGuiWindowFlags>(flags))); }
+	inline void EndChild()																				{ SOL_IMGUI_STACK_POP(Child, 1); detail::OnWindowClosing(); ImGui::EndChild(); detail::OnWindowEnd(); }
+
+	// Windows Utilities
+	inline bool IsWindowAppearing()																		{ return ImGui::IsWindowAppearing(); }
+	inline bool IsWindowCollapsed()																		{ return ImGui::IsWindowCollapsed(); }
+	inline bool IsWindowFocused()																		{ return ImGui::IsWindowFocused(); }
+	inline bool IsWindowFocused(int flags)																{ return ImGui::IsWindowFocused(static_cast<ImGuiFocusedFlags>(flags)); }
+	inline bool IsWindowHovered()																		{ return ImGui::IsWindowHovered(); }
+	inline bool IsWindowHovered(int flags)																{ return ImGui::IsWindowHovered(static_cast<ImGuiHoveredFlags>(flags)); }
+	inline ImDrawList* GetWindowDrawList()																{ return ImGui::GetWindowDrawList(); }
+	
+	#ifndef IMGUI_NO_DOCKING	// Define IMGUI_NO_DOCKING to disable this for compatibility with ImGui's master branch
+	inline float GetWindowDpiScale()																	{ return ImGui::GetWindowDpiScale(); }
+	#endif
+	
+	inline ImGuiViewport* GetWindowViewport()															{ return nullptr; /* TODO: GetWindowViewport() ==> UNSUPPORTED */ }
+	inline std::tuple<float, float> GetWindowPos()														{ const auto vec2{ ImGui::GetWindowPos() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetWindowSize()														{ const auto vec2{ ImGui::GetWindowSize() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline float GetWindowWidth()																		{ return ImGui::GetWindowWidth(); }
+	inline float GetWindowHeight()																		{ return ImGui::GetWindowHeight(); }
+
+	// Prefer using SetNext...
+	inline void SetNextWindowPos(float posX, float posY)												{ ImGui::SetNextWindowPos({ posX, posY }); }
+	inline void SetNextWindowPos(float posX, float posY, int cond)										{ ImGui::SetNextWindowPos({ posX, posY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetNextWindowPos(float posX, float posY, int cond, float pivotX, float pivotY)			{ ImGui::SetNextWindowPos({ posX, posY }, static_cast<ImGuiCond>(cond), { pivotX, pivotY }); }
+	inline void SetNextWindowSize(float sizeX, float sizeY)												{ ImGui::SetNextWindowSize({ sizeX, sizeY }); }
+	inline void SetNextWindowSize(float sizeX, float sizeY, int cond)									{ ImGui::SetNextWindowSize({ sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetNextWindowSizeConstraints(float minX, float minY, float maxX, float maxY)			{ ImGui::SetNextWindowSizeConstraints({ minX, minY }, { maxX, maxY }); }
+	inline void SetNextWindowContentSize(float sizeX, float sizeY)										{ ImGui::SetNextWindowContentSize({ sizeX, sizeY }); }
+	inline void SetNextWindowCollapsed(bool collapsed)													{ ImGui::SetNextWindowCollapsed(collapsed); }
+	inline void SetNextWindowCollapsed(bool collapsed, int cond)										{ ImGui::SetNextWindowCollapsed(collapsed, static_cast<ImGuiCond>(cond)); }
+	inline void SetNextWindowFocus()																	{ ImGui::SetNextWindowFocus(); }
+	inline void SetNextWindowBgAlpha(float alpha)														{ ImGui::SetNextWindowBgAlpha(alpha); }
+	inline void SetWindowPos(float posX, float posY)													{ ImGui::SetWindowPos({ posX, posY }); }
+	inline void SetWindowPos(float posX, float posY, int cond)											{ ImGui::SetWindowPos({ posX, posY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowSize(float sizeX, float sizeY)													{ ImGui::SetWindowSize({ sizeX, sizeY }); }
+	inline void SetWindowSize(float sizeX, float sizeY, int cond)										{ ImGui::SetWindowSize({ sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowCollapsed(bool collapsed)														{ ImGui::SetWindowCollapsed(collapsed); }
+	inline void SetWindowCollapsed(bool collapsed, int cond)											{ ImGui::SetWindowCollapsed(collapsed, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowFocus()																		{ ImGui::SetWindowFocus(); }
+	inline void SetWindowFontScale(float scale)															{ ImGui::SetWindowFontScale(scale); }
+	inline void SetWindowPos(const std::string& name, float posX, float posY)							{ ImGui::SetWindowPos(name.c_str(), { posX, posY }); }
+	inline void SetWindowPos(const std::string& name, float posX, float posY, int cond)					{ ImGui::SetWindowPos(name.c_str(), { posX, posY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowSize(const std::string& name, float sizeX, float sizeY)						{ ImGui::SetWindowSize(name.c_str(), { sizeX, sizeY }); }
+	inline void SetWindowSize(const std::string& name, float sizeX, float sizeY, int cond)				{ ImGui::SetWindowSize(name.c_str(), { sizeX, sizeY }, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowCollapsed(const std::string& name, bool collapsed)								{ ImGui::SetWindowCollapsed(name.c_str(), collapsed); }
+	inline void SetWindowCollapsed(const std::string& name, bool collapsed, int cond)					{ ImGui::SetWindowCollapsed(name.c_str(), collapsed, static_cast<ImGuiCond>(cond)); }
+	inline void SetWindowFocus(const std::string& name)													{ ImGui::SetWindowFocus(name.c_str()); }
+
+	// Content Region
+	inline std::tuple<float, float> GetContentRegionMax()												{ const auto vec2{ ImGui::GetContentRegionMax() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetContentRegionAvail()												{ const auto vec2{ ImGui::GetContentRegionAvail() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetWindowContentRegionMin()											{ const auto vec2{ ImGui::GetWindowContentRegionMin() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetWindowContentRegionMax()											{ const auto vec2{ ImGui::GetWindowContentRegionMax() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline float GetWindowContentRegionWidth()															{ return ImGui::GetWindowContentRegionMax().x - ImGui::GetWindowContentRegionMin().x; }
+
+	// Windows Scrolling
+	inline float GetScrollX()																			{ return ImGui::GetScrollX(); }
+	inline float GetScrollY()																			{ return ImGui::GetScrollY(); }
+	inline float GetScrollMaxX()																		{ return ImGui::GetScrollMaxX(); }
+	inline float GetScrollMaxY()																		{ return ImGui::GetScrollMaxY(); }
+	inline void SetScrollX(float scrollX)																{ ImGui::SetScrollX(scrollX); }
+	inline void SetScrollY(float scrollY)																{ ImGui::SetScrollY(scrollY); }
+	inline void SetScrollHereX()																		{ ImGui::SetScrollHereX(); }
+	inline void SetScrollHereX(float centerXRatio)														{ ImGui::SetScrollHereX(centerXRatio); }
+	inline void SetScrollHereY()																		{ ImGui::SetScrollHereY(); }
+	inline void SetScrollHereY(float centerYRatio)														{ ImGui::SetScrollHereY(centerYRatio); }	
+	inline void SetScrollFromPosX(float localX)															{ ImGui::SetScrollFromPosX(localX); }
+	inline void SetScrollFromPosX(float localX, float centerXRatio)										{ ImGui::SetScrollFromPosX(localX, centerXRatio); }
+	inline void SetScrollFromPosY(float localY)															{ ImGui::SetScrollFromPosY(localY); }
+	inline void SetScrollFromPosY(float localY, float centerYRatio)										{ ImGui::SetScrollFromPosY(localY, centerYRatio); }
+
+	// Parameters stacks (shared)
+	inline void PushFont(ImFont* pFont)																	{ ImGui::PushFont(pFont); SOL_IMGUI_STACK_PUSH(Font); }
+	inline void PopFont()																				{ SOL_IMGUI_STACK_POP(Font, 1); ImGui::PopFont(); }
+	inline void PushStyleColor(int idx, int col)														{ ImGui::PushStyleColor(static_cast<ImGuiCol>(idx), ImU32(col)); SOL_IMGUI_STACK_PUSH(StyleColor); }
+	inline void PushStyleColor(int idx, float colR, float colG, float colB, float colA)					{ ImGui::PushStyleColor(static_cast<ImGuiCol>(idx), { colR, colG, colB, colA }); SOL_IMGUI_STACK_PUSH(StyleColor); }
+	inline void PopStyleColor()																			{ SOL_IMGUI_STACK_POP(StyleColor, 1); ImGui::PopStyleColor(); }
+	inline void PopStyleColor(int count)																{ SOL_IMGUI_STACK_POP(StyleColor, count); ImGui::PopStyleColor(count); }
+	inline void PushStyleVar(int idx, float val)														{ ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), val); SOL_IMGUI_STACK_PUSH(StyleVar); }
+	inline void PushStyleVar(int idx, float valX, float valY)											{ ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), { valX, valY }); SOL_IMGUI_STACK_PUSH(StyleVar); }
+	inline void PopStyleVar()																			{ SOL_IMGUI_STACK_POP(StyleVar, 1); ImGui::PopStyleVar(); }
+	inline void PopStyleVar(int count)																	{ SOL_IMGUI_STACK_POP(StyleVar, count); ImGui::PopStyleVar(count); }
+	inline std::tuple<float, float, float, float> GetStyleColorVec4(int idx)							{ const auto col{ ImGui::GetStyleColorVec4(static_cast<ImGuiCol>(idx)) };	return std::make_tuple(col.x, col.y, col.z, col.w); }
+	inline ImFont* GetFont()																			{ return ImGui::GetFont(); }
+	inline float GetFontSize()																			{ return ImGui::GetFontSize(); }
+	inline std::tuple<float, float> GetFontTexUvWhitePixel()											{ const auto vec2{ ImGui::GetFontTexUvWhitePixel() };	return std::make_tuple(vec2.x, vec2.y); }
+	inline int GetColorU32(int idx, float alphaMul)														{ return ImGui::GetColorU32(static_cast<ImGuiCol>(idx), alphaMul); }
+	inline int GetColorU32(float colR, float colG, float colB, float colA)								{ return ImGui::GetColorU32({ colR, colG, colB, colA }); }
+	inline int GetColorU32(int col)																		{ return ImGui::GetColorU32(ImU32(col)); }
+	
+	// Parameters stacks (current window)
+	inline void PushItemWidth(float itemWidth)															{ ImGui::PushItemWidth(itemWidth); SOL_IMGUI_STACK_PUSH(ItemWidth); }
+	inline void PopItemWidth()																			{ SOL_IMGUI_STACK_POP(ItemWidth, 1); ImGui::PopItemWidth(); }
+	inline void SetNextItemWidth(float itemWidth)														{ ImGui::SetNextItemWidth(itemWidth); }
+	inline float CalcItemWidth()																		{ return ImGui::CalcItemWidth(); }
+	inline void PushTextWrapPos()																		{ ImGui::PushTextWrapPos(); SOL_IMGUI_STACK_PUSH(TextWrapPos); }
+	inline void PushTextWrapPos(float wrapLocalPosX)													{ ImGui::PushTextWrapPos(wrapLocalPosX); SOL_IMGUI_STACK_PUSH(TextWrapPos); }
+	inline void PopTextWrapPos()																		{ SOL_IMGUI_STACK_POP(TextWrapPos, 1); ImGui::PopTextWrapPos(); }
+	//inline void PushAllowKeyboardFocus(bool allowKeyboardFocus)											{ ImGui::PushAllowKeyboardFocus(allowKeyboardFocus); }
+	//inline void PopAllowKeyboardFocus()																	{ ImGui::PopAllowKeyboardFocus(); }
+	//inline void PushButtonRepeat(bool repeat)															{ ImGui::PushButtonRepeat(repeat); }
+	//inline void PopButtonRepeat()																		{ ImGui::PopButtonRepeat(); }
+
+	// Cursor / Layout
+	inline void Separator()																				{ ImGui::Separator(); }
+	inline void SameLine()																				{ ImGui::SameLine(); }
+	inline void SameLine(float offsetFromStartX)														{ ImGui::SameLine(offsetFromStartX); }
+	inline void SameLine(float offsetFromStartX, float spacing)											{ ImGui::SameLine(offsetFromStartX, spacing); }
+	inline void NewLine()																				{ ImGui::NewLine(); }
+	inline void Spacing()																				{ ImGui::Spacing(); }
+	inline void Dummy(float sizeX, float sizeY)															{ ImGui::Dummy({ sizeX, sizeY }); }
+	inline void Indent()																				{ ImGui::Indent(); }
+	inline void Indent(float indentW)																	{ ImGui::Indent(indentW); }
+	inline void Unindent()																				{ ImGui::Unindent(); }
+	inline void Unindent(float indentW)																	{ ImGui::Unindent(indentW); }
+	inline void BeginGroup()																			{ ImGui::BeginGroup(); SOL_IMGUI_STACK_PUSH(Group); }
+	inline void EndGroup()																				{ SOL_IMGUI_STACK_POP(Group, 1); ImGui::EndGroup(); }
+	// Runs fn in a group only when the height it took last time, estimatedHeight at first, is visible. Else only reserves
+	// that height, so long scrolling panels run the Lua of what is on screen. Returns true when fn ran.
+	inline bool LazyRegion(const std::string& id, float estimatedHeight, const sol::protected_function& fn)
+	{
+		SOL_IMGUI_ZONE("LazyRegion");
+		ImGuiStorage* storage{ ImGui::GetStateStorage() };	// the window's, so heights persist across frames
+		const ImGuiID key{ ImGui::GetID(id.c_str()) };
+		const float height{ storage->GetFloat(key, estimatedHeight) };
+		const ImVec2 min{ ImGui::GetCursorScreenPos() };
+		if (!ImGui::IsRectVisible(min, { min.x + ImGui::GetContentRegionAvail().x, min.y + height }))
+		{
+			ImGui::Dummy({ 0.0f, height });
+			return false;
+		}
+
+		BeginGroup();
+		const sol::protected_function_result result{ fn() };
+		EndGroup();
+		if (!result.valid()) throw result.get<sol::error>();
+		storage->SetFloat(key, ImGui::GetItemRectSize().y);
+		return true;
+	}
+	inline std::tuple<float, float> GetCursorPos()														{ const auto vec2{ ImGui::GetCursorPos() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline float GetCursorPosX()																		{ return ImGui::GetCursorPosX(); }
+	inline float GetCursorPosY()																		{ return ImGui::GetCursorPosY(); }
+	inline void SetCursorPos(float localX, float localY)												{ ImGui::SetCursorPos({ localX, localY }); }
+	inline void SetCursorPosX(float localX)																{ ImGui::SetCursorPosX(localX); }
+	inline void SetCursorPosY(float localY)																{ ImGui::SetCursorPosY(localY); }
+	inline std::tuple<float, float> GetCursorStartPos()													{ const auto vec2{ ImGui::GetCursorStartPos() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetCursorScreenPos()												{ const auto vec2{ ImGui::GetCursorScreenPos() };  return std::make_tuple(vec2.x, vec2.y); }
+	inline void SetCursorScreenPos(float posX, float posY)												{ ImGui::SetCursorScreenPos({ posX, posY }); }
+	inline void AlignTextToFramePadding()																{ ImGui::AlignTextToFramePadding(); }
+	inline float GetTextLineHeight()																	{ return ImGui::GetTextLineHeight(); }
+	inline float GetTextLineHeightWithSpacing()															{ return ImGui::GetTextLineHeightWithSpacing(); }
+	inline float GetFrameHeight()																		{ return ImGui::GetFrameHeight(); }
+	inline float GetFrameHeightWithSpacing()															{ return ImGui::GetFrameHeightWithSpacing(); }
+
+	// ID stack / scopes
+	inline void PushID(const std::string& stringID)														{ ImGui::PushID(stringID.c_str()); SOL_IMGUI_STACK_PUSH(ID); }
+	inline void PushID(const std::string& stringIDBegin, const std::string& stringIDEnd)				{ ImGui::PushID(stringIDBegin.c_str(), stringIDEnd.c_str()); SOL_IMGUI_STACK_PUSH(ID); }
+	inline void PushID(const void*)																		{ /* TODO: PushID(void*) ==> UNSUPPORTED */ }
+	inline void PushID(int intID)																		{ ImGui::PushID(intID); SOL_IMGUI_STACK_PUSH(ID); }
+	inline void PopID()																					{ SOL_IMGUI_STACK_POP(ID, 1); ImGui::PopID(); }
+	inline int GetID(const std::string& stringID)														{ return ImGui::GetID(stringID.c_str()); }
+	inline int GetID(const std::string& stringIDBegin, const std::string& stringIDEnd)					{ return ImGui::GetID(stringIDBegin.c_str(), stringIDEnd.c_str()); }
+	inline int GetID(const void*)																		{ return 0;  /* TODO: GetID(void*) ==> UNSUPPORTED */ }
+
+	// Widgets: Text
+	inline void TextUnformatted(const std::string& text)												{ ImGui::TextUnformatted(text.c_str()); }
+	inline void TextUnformatted(const std::string& text, const std::string& textEnd)					{ ImGui::TextUnformatted(text.c_str(), textEnd.c_str()); }
+	inline void Text(const std::string& text)															{ ImGui::Text(text.c_str()); }
+	inline void TextColored(float colR, float colG, float colB, float colA, const std::string& text)	{ ImGui::TextColored({ colR, colG, colB, colA }, text.c_str()); }
+	inline void TextDisabled(const std::string& text)													{ ImGui::TextDisabled(text.c_str()); }
+	inline void TextWrapped(const std::string text)														{ ImGui::TextWrapped(text.c_str()); }
+	inline void LabelText(const std::string& label, const std::string& text)							{ ImGui::LabelText(label.c_str(), text.c_str()); }
+	inline void BulletText(const std::string& text)														{ ImGui::BulletText(text.c_str()); }
+
+	// Widgets: Main
+	inline bool Button(const std::string& label)														{ return ImGui::Button(label.c_str()); }
+	inline bool Button(const std::string& label, float sizeX, float sizeY)								{ return ImGui::Button(label.c_str(), { sizeX, sizeY }); }
+	inline bool SmallButton(const std::string& label)													{ return ImGui::SmallButton(label.c_str()); }
+	inline bool InvisibleButton(const std::string& stringID, float sizeX, float sizeY)					{ return ImGui::InvisibleButton(stringID.c_str(), { sizeX, sizeY }); }
+	inline bool ArrowButton(const std::string& stringID, int dir)										{ return ImGui::ArrowButton(stringID.c_str(), static_cast<ImGuiDir>(dir)); }
+	inline void Image(void* textureID, float width, float height)										{ ImGui::Image(textureID, ImVec2(width, height)); }
+	//inline void ImageButton()																			{ /* TODO: ImageButton(...) ==> UNSUPPORTED */ }
+	inline std::tuple<bool, bool> Checkbox(const std::string& label, bool v)
+	{
+		bool value{ v };
+		bool pressed = ImGui::Checkbox(label.c_str(), &value);
+
+		return std::make_tuple(value, pressed);
+	}
+	inline bool CheckboxFlags()																			{ return false; /* TODO: CheckboxFlags(...) ==> UNSUPPORTED */ }
+	inline bool RadioButton(const std::string& label, bool active)										{ return ImGui::RadioButton(label.c_str(), active); }
+	inline std::tuple<int, bool> RadioButton(const std::string& label, int v, int vButton)				{ bool ret{ ImGui::RadioButton(label.c_str(), &v, vButton) }; return std::make_tuple(v, ret); }
+	inline void ProgressBar(float fraction)																{ ImGui::ProgressBar(fraction); }
+	inline void ProgressBar(float fraction, float sizeX, float sizeY)									{ ImGui::ProgressBar(fraction, { sizeX, sizeY }); }
+	inline void ProgressBar(float fraction, float sizeX, float sizeY, const std::string& overlay)		{ ImGui::ProgressBar(fraction, { sizeX, sizeY }, overlay.c_str()); }
+	inline void Bullet()																				{ ImGui::Bullet(); }
+
+	// Widgets: Combo Box
+	inline bool BeginCombo(const std::string& label, const std::string& previewValue)					{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginCombo(label.c_str(), previewValue.c_str()), Combo); }
+	inline bool BeginCombo(const std::string& label, const std::string& previewValue, int flags)		{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginCombo(label.c_str(), previewValue.c_str(), static_cast<ImGuiComboFlags>(flags)), Combo); }
+	inline void EndCombo()																				{ SOL_IMGUI_STACK_POP(Combo, 1); ImGui::EndCombo(); }
+	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const sol::table& items, int itemsCount)
+	{
+		SOL_IMGUI_ZONE("Combo");
+		std::vector<std::string> strings;
+		for (int i{ 1 }; i <= itemsCount; i++)
+		{
+			const auto& stringItem = items.get<sol::optional<std::string>>(i);
+			strings.push_back(stringItem.value_or("Missing"));
+		}
+		
+		std::vector<const char*> cstrings;
+		for (auto& string : strings)
+			cstrings.push_back(string.c_str());
+			
+		bool clicked = ImGui::Combo(label.c_str(), &currentItem, cstrings.data(), itemsCount);
+		return std::make_tuple(currentItem, clicked);
+	}
+	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const sol::table& items, int itemsCount, int popupMaxHeightInItems)
+	{
+		SOL_IMGUI_ZONE("Combo");
+		std::vector<std::string> strings;
+		for (int i{ 1 }; i <= itemsCount; i++)
+		{
+			const auto& stringItem = items.get<sol::optional<std::string>>(i);
+			strings.push_back(stringItem.value_or("Missing"));
+		}
+
+		std::vector<const char*> cstrings;
+		for (auto& string : strings)
+			cstrings.push_back(string.c_str());
+
+		bool clicked = ImGui::Combo(label.c_str(), &currentItem, cstrings.data(), itemsCount, popupMaxHeightInItems);
+		return std::make_tuple(currentItem, clicked);
+	}
+	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const std::string& itemsSeparatedByZeros)
+	{
+		SOL_IMGUI_ZONE("Combo");
+		bool clicked = ImGui::Combo(label.c_str(), &currentItem, itemsSeparatedByZeros.c_str());
+		return std::make_tuple(currentItem, clicked);
+	}
+	inline std::tuple<int, bool> Combo(const std::string& label, int currentItem, const std::string& itemsSeparatedByZeros, int popupMaxHeightInItems)
+	{
+		SOL_IMGUI_ZONE("Combo");
+		bool clicked = ImGui::Combo(label.c_str(), &currentItem, itemsSeparatedByZeros.c_str(), popupMaxHeightInItems);
+		return std::make_tuple(currentItem, clicked);
+	}
+	// TODO: 3rd Combo from ImGui not Supported
+
+	// Widgets: Scalar Buffers
+	namespace detail
+	{
+		// value converted to T, saturated to T's range for the integer types. NaN becomes 0.
+		template <typename T, typename From>
+		T SaturatedScalar(From value)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+				return static_cast<T>(value);
+			else if constexpr (std::is_floating_point_v<From>)
+			{
+				if (value != value)															return T{};
+				if (value <= static_cast<From>(std::numeric_limits<T>::lowest()))			return std::numeric_limits<T>::lowest();
+				if (value >= static_cast<From>(std::numeric_limits<T>::max()))				return std::numeric_limits<T>::max();
+				return static_cast<T>(value);
+			}
+			else if constexpr (sizeof(T) >= sizeof(From))
+				return static_cast<T>(value);	// U64 keeps the bits of a negative lua_Integer, as Lua's own unsigned conventions do
+			else
+				return static_cast<T>(std::clamp<From>(value, static_cast<From>(std::numeric_limits<T>::lowest()), static_cast<From>(std::numeric_limits<T>::max())));
+		}
+
+		// A value of dataType, stored where ImGui can read it through the void* of its Scalar functions
+		template <typename From>
+		std::uint64_t ScalarFrom(ImGuiDataType dataType, From value)
+		{
+			std::uint64_t storage{};
+			const auto Store = [&storage](auto scalar) { std::memcpy(&storage, &scalar, sizeof(scalar)); };
+			switch (dataType)
+			{
+			case ImGuiDataType_S8:		Store(SaturatedScalar<std::int8_t>(value)); break;
+			case ImGuiDataType_U8:		Store(SaturatedScalar<std::uint8_t>(value)); break;
+			case ImGuiDataType_S16:		Store(SaturatedScalar<std::int16_t>(value)); break;
+			case ImGuiDataType_U16:		Store(SaturatedScalar<std::uint16_t>(value)); break;
+			case ImGuiDataType_S32:		Store(SaturatedScalar<std::int32_t>(value)); break;
+			case ImGuiDataType_U32:		Store(SaturatedScalar<std::uint32_t>(value)); break;
+			case ImGuiDataType_S64:		Store(SaturatedScalar<std::int64_t>(value)); break;
+			case ImGuiDataType_U64:		Store(SaturatedScalar<std::uint64_t>(value)); break;
+			case ImGuiDataType_Float:	Store(SaturatedScalar<float>(value)); break;
+			default:					Store(SaturatedScalar<double>(value)); break;
+			}
+			return storage;
+		}
+		inline std::uint64_t ScalarFromNumber(ImGuiDataType dataType, lua_Number value)		{ return ScalarFrom(dataType, value); }
+		inline std::uint64_t ScalarFromInteger(ImGuiDataType dataType, lua_Integer value)	{ return ScalarFrom(dataType, value); }
+
+		// Lua 5.3 and later tell integers from floats, older runtimes only have lua_Number
+		inline bool IsLuaInteger(lua_State* L, int index)
+		{
+		#if LUA_VERSION_NUM >= 503
+			return lua_isinteger(L, index) != 0;
+		#else
+			(void)L; (void)index;
+			return false;
+		#endif
+		}
+
+		// The value of dataType at data, as a Result
+		template <typename Result>
+		Result ScalarAs(ImGuiDataType dataType, const void* data)
+		{
+			const auto Load = [data](auto scalar) { std::memcpy(&scalar, data, sizeof(scalar)); return static_cast<Result>(scalar); };
+			switch (dataType)
+			{
+			case ImGuiDataType_S8:		return Load(std::int8_t{});
+			case ImGuiDataType_U8:		return Load(std::uint8_t{});
+			case ImGuiDataType_S16:		return Load(std::int16_t{});
+			case ImGuiDataType_U16:		return Load(std::uint16_t{});
+			case ImGuiDataType_S32:		return Load(std::int32_t{});
+			case ImGuiDataType_U32:		return Load(std::uint32_t{});
+			case ImGuiDataType_S64:		return Load(std::int64_t{});
+			case ImGuiDataType_U64:		return Load(std::uint64_t{});
+			case ImGuiDataType_Float:	return Load(float{});
+			default:					return Load(double{});
+			}
+		}
+	}
+
+	// Typed array the Scalar widgets edit in place: memory the buffer owns, or a view over host memory, e.g.
+	//     lua["Bones"] = sol_ImGui::ScalarBuffer(ImGuiDataType_Float, &bones[0].transform[0][0], boneCount * 16);
+	class ScalarBuffer
+	{
+	public:
+		// Zeroed elements owned by the buffer
+		ScalarBuffer(ImGuiDataType dataType, int count)
+			: dataType(CheckedType(dataType)), count(std::max(count, 0)), stride(static_cast<int>(SizeOf(dataType))), owned(static_cast<std::size_t>(this->count) * stride), data(owned.data()) {}
+		// View over host memory, which must outlive it. stride is the distance in bytes between elements, 0 when they are packed.
+		ScalarBuffer(ImGuiDataType dataType, void* data, int count, int stride = 0)
+			: dataType(CheckedType(dataType)), count(std::max(count, 0)), stride(stride > 0 ? stride : static_cast<int>(SizeOf(dataType))), data(static_cast<unsigned char*>(data)) {}
+		ScalarBuffer(const ScalarBuffer& other)
+			: dataType(other.dataType), count(other.count), stride(other.stride), owned(other.owned), data(owned.empty() ? other.data : owned.data()) {}
+		ScalarBuffer(ScalarBuffer&&) = default;	// the owned elements keep their address
+		ScalarBuffer& operator=(const ScalarBuffer&) = delete;
+		ScalarBuffer& operator=(ScalarBuffer&&) = delete;
+
+		static std::size_t SizeOf(ImGuiDataType dataType)
+		{
+			switch (dataType)
+			{
+			case ImGuiDataType_S8:	case ImGuiDataType_U8:										return 1;
+			case ImGuiDataType_S16:	case ImGuiDataType_U16:										return 2;
+			case ImGuiDataType_S32:	case ImGuiDataType_U32:	case ImGuiDataType_Float:			return 4;
+			default:																			return 8;
+			}
+		}
+		static bool IsInteger(ImGuiDataType dataType)													{ return dataType != ImGuiDataType_Float && dataType != ImGuiDataType_Double; }
+
+		ImGuiDataType GetType() const																	{ return dataType; }
+		int GetCount() const																			{ return count; }
+		int GetStride() const																			{ return stride; }
+		bool IsPacked() const																			{ return stride == static_cast<int>(SizeOf(dataType)); }
+		void* Element(int index) const																	{ return data + static_cast<std::ptrdiff_t>(index) * stride; }	// 0-based
+
+		// 1-based, for Lua. The integer types go through lua_Integer, so 64-bit values keep their precision.
+		sol::object Get(sol::this_state s, int index) const
+		{
+			const void* element{ Element(Checked(index)) };
+			if (IsInteger(dataType)) return sol::make_object(s, detail::ScalarAs<lua_Integer>(dataType, element));
+			return sol::make_object(s, detail::ScalarAs<lua_Number>(dataType, element));
+		}
+		void Set(int index, const sol::stack_object& value)
+		{
+			lua_State* L{ value.lua_state() };
+			const int at{ value.stack_index() };
+			if (value.get_type() != sol::type::number) throw sol::error("ImGuiScalarBuffer: Set expects a number, got " + sol::type_name(L, value.get_type()));
+			const std::uint64_t scalar{ detail::IsLuaInteger(L, at) ? detail::ScalarFromInteger(dataType, lua_tointeger(L, at)) : detail::ScalarFromNumber(dataType, lua_tonumber(L, at)) };
+			std::memcpy(Element(Checked(index)), &scalar, SizeOf(dataType));
+		}
+
+	private:
+		static ImGuiDataType CheckedType(ImGuiDataType dataType)
+		{
+			if (dataType < 0 || dataType >= ImGuiDataType_COUNT) throw sol::error("ImGuiScalarBuffer: " + std::to_string(dataType) + " is not an ImGuiDataType");
+			return dataType;
+		}
+		int Checked(int index) const
+		{
+			if (index < 1 || index > count) throw sol::error("ImGuiScalarBuffer: index " + std::to_string(index) + " is out of 1.." + std::to_string(count));
+			return index - 1;
+		}
+
+		ImGuiDataType				dataType;
+		int							count;
+		int							stride;
+		std::vector<unsigned char>	owned;
+		unsigned char*				data;
+	};
+
+	namespace detail
+	{
+		// Runs widget(data) over count elements of buffer from first (0-based). In place when the elements are packed,
+		// else on a packed copy, scattered back when the widget changed it.
+		template <typename Widget>
+		bool EditScalars(ScalarBuffer& buffer, int first, int count, Widget&& widget)
+		{
+			if (first < 0 || count < 1 || count > buffer.GetCount() - first)
+				throw sol::error("scalar widget: " + std::to_string(count) + " elements from " + std::to_string(static_cast<long long>(first) + 1) + " are out of the buffer's 1.." + std::to_string(buffer.GetCount()));
+			if (buffer.IsPacked()) return widget(buffer.Element(first));
+
+			const std::size_t size{ ScalarBuffer::SizeOf(buffer.GetType()) };
+			thread_local std::vector<unsigned char> packed;
+			packed.resize(size * count);
+			for (int i = 0; i < count; i++) std::memcpy(&packed[size * i], buffer.Element(first + i), size);
+			if (!widget(packed.data())) return false;
+			for (int i = 0; i < count; i++) std::memcpy(buffer.Element(first + i), &packed[size * i], size);
+			return true;
+		}
+
+		inline bool DragScalars(const std::string& label, ScalarBuffer& buffer, int first, int count, bool single, float speed, std::optional<lua_Number> min, std::optional<lua_Number> max, const char* format, int flags)
+		{
+			const ImGuiDataType dataType{ buffer.GetType() };
+			const std::uint64_t low{ min ? ScalarFromNumber(dataType, *min) : 0 }, high{ max ? ScalarFromNumber(dataType, *max) : 0 };
+			return EditScalars(buffer, first, count, [&](void* data)
+			{
+				return single	? ImGui::DragScalar(label.c_str(), dataType, data, speed, min ? &low : nullptr, max ? &high : nullptr, format, static_cast<ImGuiSliderFlags>(flags))
+								: ImGui::DragScalarN(label.c_str(), dataType, data, count, speed, min ? &low : nullptr, max ? &high : nullptr, format, static_cast<ImGuiSliderFlags>(flags));
+			});
+		}
+		inline bool SliderScalars(const std::string& label, ScalarBuffer& buffer, int first, int count, bool single, lua_Number min, lua_Number max, const char* format, int flags)
+		{
+			const ImGuiDataType dataType{ buffer.GetType() };
+			const std::uint64_t low{ ScalarFromNumber(dataType, min) }, high{ ScalarFromNumber(dataType, max) };
+			return EditScalars(buffer, first, count, [&](void* data)
+			{
+				return single	? ImGui::SliderScalar(label.c_str(), dataType, data, &low, &high, format, static_cast<ImGuiSliderFlags>(flags))
+								: ImGui::SliderScalarN(label.c_str(), dataType, data, count, &low, &high, format, static_cast<ImGuiSliderFlags>(flags));
+			});
+		}
+		inline bool InputScalars(const std::string& label, ScalarBuffer& buffer, int first, int count, bool single, std::optional<lua_Number> step, std::optional<lua_Number> stepFast, const char* format, int flags)
+		{
+			const ImGuiDataType dataType{ buffer.GetType() };
+			const std::uint64_t slow{ step ? ScalarFromNumber(dataType, *step) : 0 }, fast{ stepFast ? ScalarFromNumber(dataType, *stepFast) : 0 };
+			return EditScalars(buffer, first, count, [&](void* data)
+			{
+				return single	? ImGui::InputScalar(label.c_str(), dataType, data, step ? &slow : nullptr, stepFast ? &fast : nullptr, format, static_cast<ImGuiInputTextFlags>(flags))
+								: ImGui::InputScalarN(label.c_str(), dataType, data, count, step ? &slow : nullptr, stepFast ? &fast : nullptr, format, static_cast<ImGuiInputTextFlags>(flags));
+			});
+		}
+	}
+
+	// Widgets: Drags
+	inline std::tuple<float, bool> DragFloat(const std::string& label, float v)																											{ bool used = ImGui::DragFloat(label.c_str(), &v); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed)																							{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min)																				{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max)																{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max, const std::string& format)										{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> DragFloat(const std::string& label, float v, float v_speed, float v_min, float v_max, const std::string& format, int flags)							{ bool used = ImGui::DragFloat(label.c_str(), &v, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags) flags); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::DragFloat2(label.c_str(), value);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat2(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::DragFloat2(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::DragFloat3(label.c_str(), value);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat3(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::DragFloat3(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::DragFloat4(label.c_str(), value);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> DragFloat4(const std::string& label, const sol::table& v, float v_speed, float v_min, float v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::DragFloat4(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline void DragFloatRange2()																																						{ /* TODO: DragFloatRange2(...) ==> UNSUPPORTED */ }
+	inline std::tuple<int, bool> DragInt(const std::string& label, int v)																												{ bool used = ImGui::DragInt(label.c_str(), &v); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed)																								{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min)																						{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max)																			{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max, const std::string& format)												{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> DragInt(const std::string& label, int v, float v_speed, int v_min, int v_max, const std::string& format, int flags)									{ bool used = ImGui::DragInt(label.c_str(), &v, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::DragInt2(label.c_str(), value);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::DragInt2(label.c_str(), value, v_speed);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt2(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::DragInt2(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::DragInt3(label.c_str(), value);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::DragInt3(label.c_str(), value, v_speed);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt3(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::DragInt3(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::DragInt4(label.c_str(), value);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::DragInt4(label.c_str(), value, v_speed);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max, format.c_str());
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> DragInt4(const std::string& label, const sol::table& v, float v_speed, int v_min, int v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::DragInt4(label.c_str(), value, v_speed, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline void DragIntRange2()																																							{ /* TODO: DragIntRange2(...) ==> UNSUPPORTED */ }
+	inline bool DragScalar(const std::string& label, ScalarBuffer& buffer)																												{ return detail::DragScalars(label, buffer, 0, 1, true, 1.0f, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool DragScalar(const std::string& label, ScalarBuffer& buffer, int index)																									{ return detail::DragScalars(label, buffer, index - 1, 1, true, 1.0f, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool DragScalar(const std::string& label, ScalarBuffer& buffer, int index, float v_speed)																					{ return detail::DragScalars(label, buffer, index - 1, 1, true, v_speed, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool DragScalar(const std::string& label, ScalarBuffer& buffer, int index, float v_speed, lua_Number v_min, lua_Number v_max)												{ return detail::DragScalars(label, buffer, index - 1, 1, true, v_speed, v_min, v_max, nullptr, 0); }
+	inline bool DragScalar(const std::string& label, ScalarBuffer& buffer, int index, float v_speed, lua_Number v_min, lua_Number v_max, const std::string& format)						{ return detail::DragScalars(label, buffer, index - 1, 1, true, v_speed, v_min, v_max, format.c_str(), 0); }
+	inline bool DragScalar(const std::string& label, ScalarBuffer& buffer, int index, float v_speed, lua_Number v_min, lua_Number v_max, const std::string& format, int flags)			{ return detail::DragScalars(label, buffer, index - 1, 1, true, v_speed, v_min, v_max, format.c_str(), flags); }
+	inline bool DragScalarN(const std::string& label, ScalarBuffer& buffer)																											{ return detail::DragScalars(label, buffer, 0, buffer.GetCount(), false, 1.0f, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool DragScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components)																				{ return detail::DragScalars(label, buffer, first - 1, components, false, 1.0f, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool DragScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, float v_speed)																	{ return detail::DragScalars(label, buffer, first - 1, components, false, v_speed, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool DragScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, float v_speed, lua_Number v_min, lua_Number v_max)								{ return detail::DragScalars(label, buffer, first - 1, components, false, v_speed, v_min, v_max, nullptr, 0); }
+	inline bool DragScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, float v_speed, lua_Number v_min, lua_Number v_max, const std::string& format)		{ return detail::DragScalars(label, buffer, first - 1, components, false, v_speed, v_min, v_max, format.c_str(), 0); }
+	inline bool DragScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, float v_speed, lua_Number v_min, lua_Number v_max, const std::string& format, int flags)	{ return detail::DragScalars(label, buffer, first - 1, components, false, v_speed, v_min, v_max, format.c_str(), flags); }
+
+	// Widgets: Sliders
+	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max)																				{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max, const std::string& format)													{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> SliderFloat(const std::string& label, float v, float v_min, float v_max, const std::string& format, int flags)										{ bool used = ImGui::SliderFloat(label.c_str(), &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max, format.c_str());
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat2(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::SliderFloat2(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[3]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max, format.c_str());
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[3]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat3(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::SliderFloat3(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[3]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max, format.c_str());
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad)																									{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min)																				{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max)															{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max, const std::string& format)								{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max, format.c_str()); return std::make_tuple(v_rad, used); }
+	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max, const std::string& format, int flags)					{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v_rad, used); }
+	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max)																						{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max, const std::string& format)															{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max, const std::string& format, int flags)													{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max, format.c_str());
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max, format.c_str());
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max, format.c_str());
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline bool SliderScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number v_min, lua_Number v_max)																{ return detail::SliderScalars(label, buffer, index - 1, 1, true, v_min, v_max, nullptr, 0); }
+	inline bool SliderScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number v_min, lua_Number v_max, const std::string& format)									{ return detail::SliderScalars(label, buffer, index - 1, 1, true, v_min, v_max, format.c_str(), 0); }
+	inline bool SliderScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number v_min, lua_Number v_max, const std::string& format, int flags)						{ return detail::SliderScalars(label, buffer, index - 1, 1, true, v_min, v_max, format.c_str(), flags); }
+	inline bool SliderScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number v_min, lua_Number v_max)											{ return detail::SliderScalars(label, buffer, first - 1, components, false, v_min, v_max, nullptr, 0); }
+	inline bool SliderScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number v_min, lua_Number v_max, const std::string& format)					{ return detail::SliderScalars(label, buffer, first - 1, components, false, v_min, v_max, format.c_str(), 0); }
+	inline bool SliderScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number v_min, lua_Number v_max, const std::string& format, int flags)		{ return detail::SliderScalars(label, buffer, first - 1, components, false, v_min, v_max, format.c_str(), flags); }
+	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max)													{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max, const std::string& format)						{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max, const std::string& format, int flags)			{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max)															{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max, const std::string& format)									{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
+	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max, const std::string& format, int flags)						{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
+	inline bool VSliderScalar(const std::string& label, float sizeX, float sizeY, ScalarBuffer& buffer, int index, lua_Number v_min, lua_Number v_max, const std::string& format, int flags)
+	{
+		const ImGuiDataType dataType{ buffer.GetType() };
+		const std::uint64_t low{ detail::ScalarFromNumber(dataType, v_min) }, high{ detail::ScalarFromNumber(dataType, v_max) };
+		return detail::EditScalars(buffer, index - 1, 1, [&](void* data) { return ImGui::VSliderScalar(label.c_str(), { sizeX, sizeY }, dataType, data, &low, &high, format.empty() ? nullptr : format.c_str(), static_cast<ImGuiSliderFlags>(flags)); });
+	}
+	inline bool VSliderScalar(const std::string& label, float sizeX, float sizeY, ScalarBuffer& buffer, int index, lua_Number v_min, lua_Number v_max)									{ return VSliderScalar(label, sizeX, sizeY, buffer, index, v_min, v_max, {}, 0); }
+	inline bool VSliderScalar(const std::string& label, float sizeX, float sizeY, ScalarBuffer& buffer, int index, lua_Number v_min, lua_Number v_max, const std::string& format)		{ return VSliderScalar(label, sizeX, sizeY, buffer, index, v_min, v_max, format, 0); }
+
+	// Widgets: Input with Keyboard
+	inline std::tuple<std::string, bool> InputText(const std::string& label, std::string text)																							{ bool selected = ImGui::InputText(label.c_str(), &text); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputText(const std::string& label, std::string text, int flags)																				{ bool selected = ImGui::InputText(label.c_str(), &text, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text)																					{ SOL_IMGUI_ZONE("InputTextMultiline"); bool selected = ImGui::InputTextMultiline(label.c_str(), &text); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, float sizeX, float sizeY)														{ SOL_IMGUI_ZONE("InputTextMultiline"); bool selected = ImGui::InputTextMultiline(label.c_str(), &text, { sizeX, sizeY }); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, float sizeX, float sizeY, int flags)											{ SOL_IMGUI_ZONE("InputTextMultiline"); bool selected = ImGui::InputTextMultiline(label.c_str(), &text, { sizeX, sizeY }, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextWithHint(const std::string& label, const std::string& hint, std::string text)															{ bool selected = ImGui::InputTextWithHint(label.c_str(), hint.c_str(), &text); return std::make_tuple(text, selected); }
+	inline std::tuple<std::string, bool> InputTextWithHint(const std::string& label, const std::string& hint, std::string text, int flags)												{ bool selected = ImGui::InputTextWithHint(label.c_str(), hint.c_str(), &text, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
+	inline std::tuple<float, bool> InputFloat(const std::string& label, float v)																										{ bool selected = ImGui::InputFloat(label.c_str(), &v); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step)																							{ bool selected = ImGui::InputFloat(label.c_str(), &v, step); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast)																			{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast, const std::string& format)												{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast, format.c_str()); return std::make_tuple(v, selected); }
+	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast, const std::string& format, int flags)										{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast, format.c_str(), static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::InputFloat2(label.c_str(), value);
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::InputFloat2(label.c_str(), value, format.c_str());
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[2] = { float(v1), float(v2) };
+		bool used = ImGui::InputFloat2(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+
+		sol::as_table_t float2 = sol::as_table(std::vector<float>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(float2, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::InputFloat3(label.c_str(), value);
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::InputFloat3(label.c_str(), value, format.c_str());
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[3] = { float(v1), float(v2), float(v3) };
+		bool used = ImGui::InputFloat3(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+
+		sol::as_table_t float3 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(float3, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::InputFloat4(label.c_str(), value);
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v, const std::string& format)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::InputFloat4(label.c_str(), value, format.c_str());
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v, const std::string& format, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
+		bool used = ImGui::InputFloat4(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+
+		sol::as_table_t float4 = sol::as_table(std::vector<float>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(float4, used);
+	}
+	inline std::tuple<int, bool> InputInt(const std::string& label, int v)																												{ bool selected = ImGui::InputInt(label.c_str(), &v); return std::make_tuple(v, selected); }
+	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step)																									{ bool selected = ImGui::InputInt(label.c_str(), &v, step); return std::make_tuple(v, selected); }
+	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step, int step_fast)																						{ bool selected = ImGui::InputInt(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
+	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step, int step_fast, int flags)																			{ bool selected = ImGui::InputInt(label.c_str(), &v, step, step_fast, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::InputInt2(label.c_str(), value);
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const std::string& label, const sol::table& v, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[2] = { int(v1), int(v2) };
+		bool used = ImGui::InputInt2(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+
+		sol::as_table_t int2 = sol::as_table(std::vector<int>{
+			value[0], value[1]
+		});
+
+		return std::make_tuple(int2, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::InputInt3(label.c_str(), value);
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const std::string& label, const sol::table& v, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[3] = { int(v1), int(v2), int(v3) };
+		bool used = ImGui::InputInt3(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+
+		sol::as_table_t int3 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2]
+		});
+
+		return std::make_tuple(int3, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const std::string& label, const sol::table& v)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::InputInt4(label.c_str(), value);
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const std::string& label, const sol::table& v, int flags)
+	{
+		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
+		bool used = ImGui::InputInt4(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+
+		sol::as_table_t int4 = sol::as_table(std::vector<int>{
+			value[0], value[1], value[2], value[3]
+		});
+
+		return std::make_tuple(int4, used);
+	}
+	inline std::tuple<double, bool> InputDouble(const std::string& label, double v)																										{ bool selected = ImGui::InputDouble(label.c_str(), &v); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step)																						{ bool selected = ImGui::InputDouble(label.c_str(), &v, step); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast)																		{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast, const std::string& format)											{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast, format.c_str()); return std::make_tuple(v, selected); }
+	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast, const std::string& format, int flags)								{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast, format.c_str(), static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
+	inline bool InputScalar(const std::string& label, ScalarBuffer& buffer)																											{ return detail::InputScalars(label, buffer, 0, 1, true, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool InputScalar(const std::string& label, ScalarBuffer& buffer, int index)																								{ return detail::InputScalars(label, buffer, index - 1, 1, true, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool InputScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number step)																				{ return detail::InputScalars(label, buffer, index - 1, 1, true, step, std::nullopt, nullptr, 0); }
+	inline bool InputScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number step, lua_Number step_fast)															{ return detail::InputScalars(label, buffer, index - 1, 1, true, step, step_fast, nullptr, 0); }
+	inline bool InputScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number step, lua_Number step_fast, const std::string& format)								{ return detail::InputScalars(label, buffer, index - 1, 1, true, step, step_fast, format.c_str(), 0); }
+	inline bool InputScalar(const std::string& label, ScalarBuffer& buffer, int index, lua_Number step, lua_Number step_fast, const std::string& format, int flags)					{ return detail::InputScalars(label, buffer, index - 1, 1, true, step, step_fast, format.c_str(), flags); }
+	inline bool InputScalarN(const std::string& label, ScalarBuffer& buffer)																											{ return detail::InputScalars(label, buffer, 0, buffer.GetCount(), false, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool InputScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components)																				{ return detail::InputScalars(label, buffer, first - 1, components, false, std::nullopt, std::nullopt, nullptr, 0); }
+	inline bool InputScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number step)																{ return detail::InputScalars(label, buffer, first - 1, components, false, step, std::nullopt, nullptr, 0); }
+	inline bool InputScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number step, lua_Number step_fast)											{ return detail::InputScalars(label, buffer, first - 1, components, false, step, step_fast, nullptr, 0); }
+	inline bool InputScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number step, lua_Number step_fast, const std::string& format)				{ return detail::InputScalars(label, buffer, first - 1, components, false, step, step_fast, format.c_str(), 0); }
+	inline bool InputScalarN(const std::string& label, ScalarBuffer& buffer, int first, int components, lua_Number step, lua_Number step_fast, const std::string& format, int flags)	{ return detail::InputScalars(label, buffer, first - 1, components, false, step, step_fast, format.c_str(), flags); }
+
+	// Widgets: Color Editor / Picker
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const std::string& label, const sol::table& col)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+			b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[3] = { float(r), float(g), float(b) };
+		bool used = ImGui::ColorEdit3(label.c_str(), color);
+
+		sol::as_table_t rgb = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2]
+		});
+
+		return std::make_tuple(rgb, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const std::string& label, const sol::table& col, int flags)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[3] = { float(r), float(g), float(b) };
+		bool used = ImGui::ColorEdit3(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+
+		sol::as_table_t rgb = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2]
+		});
+
+		return std::make_tuple(rgb, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const std::string& label, const sol::table& col)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[4] = { float(r), float(g), float(b), float(a) };
+		bool used = ImGui::ColorEdit4(label.c_str(), color);
+
+		sol::as_table_t rgba = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2], color[3]
+		});
+
+		return std::make_tuple(rgba, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const std::string& label, const sol::table& col, int flags)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[4] = { float(r), float(g), float(b), float(a) };
+		bool used = ImGui::ColorEdit4(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+
+		sol::as_table_t rgba = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2], color[3]
+		});
+
+		return std::make_tuple(rgba, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const std::string& label, const sol::table& col)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[3] = { float(r), float(g), float(b) };
+		bool used = ImGui::ColorPicker3(label.c_str(), color);
+
+		sol::as_table_t rgb = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2]
+		});
+
+		return std::make_tuple(rgb, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const std::string& label, const sol::table& col, int flags)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[3] = { float(r), float(g), float(b) };
+		bool used = ImGui::ColorPicker3(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+
+		sol::as_table_t rgb = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2]
+		});
+
+		return std::make_tuple(rgb, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const std::string& label, const sol::table& col)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[4] = { float(r), float(g), float(b), float(a) };
+		bool used = ImGui::ColorPicker4(label.c_str(), color);
+
+		sol::as_table_t rgba = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2], color[3]
+		});
+
+		return std::make_tuple(rgba, used);
+	}
+	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const std::string& label, const sol::table& col, int flags)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		float color[4] = { float(r), float(g), float(b), float(a) };
+		bool used = ImGui::ColorPicker4(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+
+		sol::as_table_t rgba = sol::as_table(std::vector<float>{
+			color[0], color[1], color[2], color[3]
+		});
+
+		return std::make_tuple(rgba, used);
+	}
+	inline bool ColorButton(const std::string& desc_id, const sol::table& col)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		const ImVec4 color{ float(r), float(g), float(b), float(a) };
+		return ImGui::ColorButton(desc_id.c_str(), color);
+	}
+	inline bool ColorButton(const std::string& desc_id, const sol::table& col, int flags)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		const ImVec4 color{ float(r), float(g), float(b), float(a) };
+		return ImGui::ColorButton(desc_id.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> SliderFloat4(const std::string& label, const sol::table& v, float v_min, float v_max, const std::string& format, int flags)
+	inline bool ColorButton(const std::string& desc_id, const sol::table& col, int flags, float sizeX, float sizeY)
+	{
+		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		const ImVec4 color{ float(r), float(g), float(b), float(a) };
+		return ImGui::ColorButton(desc_id.c_str(), color, static_cast<ImGuiColorEditFlags>(flags), { sizeX, sizeY });
+	}
+	inline void SetColorEditOptions(int flags)																																			{ ImGui::SetColorEditOptions(static_cast<ImGuiColorEditFlags>(flags)); }
+
+	// Widgets: Trees
+	inline bool TreeNode(const std::string& label)														{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::TreeNode(label.c_str()), Tree); }
+	inline bool TreeNode(const std::string& label, const std::string& fmt)								{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::TreeNode(label.c_str(), fmt.c_str()), Tree); }
+	/* TODO: TreeNodeV(...) (2) ==> UNSUPPORTED */
+	inline bool TreeNodeEx(const std::string& label)													{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::TreeNodeEx(label.c_str()), Tree); }
+	inline bool TreeNodeEx(const std::string& label, int flags)											{ const bool open{ ImGui::TreeNodeEx(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags)) }; if (open && !(flags & ImGuiTreeNodeFlags_NoTreePushOnOpen)) SOL_IMGUI_STACK_PUSH(Tree); return open; }
+	inline bool TreeNodeEx(const std::string& label, int flags, const std::string& fmt)					{ const bool open{ ImGui::TreeNodeEx(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags), fmt.c_str()) }; if (open && !(flags & ImGuiTreeNodeFlags_NoTreePushOnOpen)) SOL_IMGUI_STACK_PUSH(Tree); return open; }
+	/* TODO: TreeNodeExV(...) (2) ==> UNSUPPORTED */
+	inline void TreePush(const std::string& str_id)														{ ImGui::TreePush(str_id.c_str()); SOL_IMGUI_STACK_PUSH(Tree); }
+	/* TODO: TreePush(const void*) ==> UNSUPPORTED */
+	inline void TreePop()																				{ SOL_IMGUI_STACK_POP(Tree, 1); ImGui::TreePop(); }
+	inline float GetTreeNodeToLabelSpacing()															{ return ImGui::GetTreeNodeToLabelSpacing(); }
+	inline bool CollapsingHeader(const std::string& label)												{ return ImGui::CollapsingHeader(label.c_str()); }
+	inline bool CollapsingHeader(const std::string& label, int flags)									{ return ImGui::CollapsingHeader(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags)); }
+	inline std::tuple<bool, bool> CollapsingHeader(const std::string& label, bool open)					{ bool notCollapsed = ImGui::CollapsingHeader(label.c_str(), &open); return std::make_tuple(open, notCollapsed); }
+	inline std::tuple<bool, bool> CollapsingHeader(const std::string& label, bool open, int flags)		{ bool notCollapsed = ImGui::CollapsingHeader(label.c_str(), &open, static_cast<ImGuiTreeNodeFlags>(flags)); return std::make_tuple(open, notCollapsed); }
+	inline void SetNextItemOpen(bool is_open)															{ ImGui::SetNextItemOpen(is_open); }
+	inline void SetNextItemOpen(bool is_open, int cond)													{ ImGui::SetNextItemOpen(is_open, static_cast<ImGuiCond>(cond)); }
+
+	// Widgets: Selectables
+	// TODO: Only one of Selectable variations is possible due to same parameters for Lua
+	inline bool Selectable(const std::string& label)													{ return ImGui::Selectable(label.c_str()); }
+	inline bool Selectable(const std::string& label, bool selected)										{ ImGui::Selectable(label.c_str(), &selected); return selected; }
+	inline bool Selectable(const std::string& label, bool selected, int flags)							{ ImGui::Selectable(label.c_str(), &selected, static_cast<ImGuiSelectableFlags>(flags)); return selected; }
+	inline bool Selectable(const std::string& label, bool selected, int flags, float sizeX, float sizeY){ ImGui::Selectable(label.c_str(), &selected, static_cast<ImGuiSelectableFlags>(flags), { sizeX, sizeY }); return selected; }
+
+	// Widgets: List Boxes
+	inline std::tuple<int, bool> ListBox(const std::string& label, int current_item, const sol::table& items, int items_count)
+	{
+		SOL_IMGUI_ZONE("ListBox");
+		std::vector<std::string> strings;
+		for (int i{ 1 }; i <= items_count; i++)
+		{
+			const auto& stringItem = items.get<sol::optional<std::string>>(i);
+			strings.push_back(stringItem.value_or("Missing"));
+		}
+
+		std::vector<const char*> cstrings;
+		for (auto& string : strings)
+			cstrings.push_back(string.c_str());
+
+		bool clicked = ImGui::ListBox(label.c_str(), &current_item, cstrings.data(), items_count);
+		return std::make_tuple(current_item, clicked);
+	}
+	inline std::tuple<int, bool> ListBox(const std::string& label, int current_item, const sol::table& items, int items_count, int height_in_items)
+	{
+		SOL_IMGUI_ZONE("ListBox");
+		std::vector<std::string> strings;
+		for (int i{ 1 }; i <= items_count; i++)
+		{
+			const auto& stringItem = items.get<sol::optional<std::string>>(i);
+			strings.push_back(stringItem.value_or("Missing"));
+		}
+
+		std::vector<const char*> cstrings;
+		for (auto& string : strings)
+			cstrings.push_back(string.c_str());
+
+		bool clicked = ImGui::ListBox(label.c_str(), &current_item, cstrings.data(), items_count, height_in_items);
+		return std::make_tuple(current_item, clicked);
+	}
+	inline bool BeginListBox(const std::string& label, float sizeX, float sizeY)						{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginListBox(label.c_str(), { sizeX, sizeY }), ListBox); }
+	inline bool BeginListBox(const std::string& label)													{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginListBox(label.c_str()), ListBox); }
+	inline void EndListBox()																			{ SOL_IMGUI_STACK_POP(ListBox, 1); ImGui::EndListBox(); }
+
+	// Widgets: Data Plotting
+	/* TODO: Widgets Data Plotting ==> UNSUPPORTED (barely used and quite long functions) */
+
+	// Widgets: Value() helpers
+	inline void Value(const std::string& prefix, bool b)												{ ImGui::Value(prefix.c_str(), b); }
+	inline void Value(const std::string& prefix, int v)													{ ImGui::Value(prefix.c_str(), v); }
+	inline void Value(const std::string& prefix, unsigned int v)										{ ImGui::Value(prefix.c_str(), v); }
+	inline void Value(const std::string& prefix, float v)												{ ImGui::Value(prefix.c_str(), v); }
+	inline void Value(const std::string& prefix, float v, const std::string& float_format)				{ ImGui::Value(prefix.c_str(), v, float_format.c_str()); }
+
+	// Widgets: Menus
+	inline bool BeginMenuBar()																			{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginMenuBar(), MenuBar); }
+	inline void EndMenuBar()																			{ SOL_IMGUI_STACK_POP(MenuBar, 1); ImGui::EndMenuBar(); }
+	inline bool BeginMainMenuBar()																		{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginMainMenuBar(), MainMenuBar); }
+	inline void EndMainMenuBar()																		{ SOL_IMGUI_STACK_POP(MainMenuBar, 1); ImGui::EndMainMenuBar(); }
+	inline bool BeginMenu(const std::string& label)														{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginMenu(label.c_str()), Menu); }
+	inline bool BeginMenu(const std::string& label, bool enabled)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginMenu(label.c_str(), enabled), Menu); }
+	inline void EndMenu()																				{ SOL_IMGUI_STACK_POP(Menu, 1); ImGui::EndMenu(); }
+	inline bool MenuItem(const std::string& label)																					{ return ImGui::MenuItem(label.c_str()); }
+	inline bool MenuItem(const std::string& label, const std::string& shortcut)														{ return ImGui::MenuItem(label.c_str(), shortcut.c_str()); }
+	inline std::tuple<bool, bool> MenuItem(const std::string& label, const std::string& shortcut, bool selected)					{ bool activated = ImGui::MenuItem(label.c_str(), shortcut.c_str(), &selected); return std::make_tuple(selected, activated); }
+	inline std::tuple<bool, bool> MenuItem(const std::string& label, const std::string& shortcut, bool selected, bool enabled)		{ bool activated = ImGui::MenuItem(label.c_str(), shortcut.c_str(), &selected, enabled); return std::make_tuple(selected, activated); }
+
+	// Tooltips
+	inline void BeginTooltip()																			{ ImGui::BeginTooltip(); SOL_IMGUI_STACK_PUSH(Tooltip); }
+	inline void EndTooltip()																			{ SOL_IMGUI_STACK_POP(Tooltip, 1); ImGui::EndTooltip(); }
+	inline void SetTooltip(const std::string& fmt)														{ ImGui::SetTooltip(fmt.c_str()); }
+	inline void SetTooltipV()																			{ /* TODO: SetTooltipV(...) ==> UNSUPPORTED */ }
+
+	// Popups, Modals
+	inline bool BeginPopup(const std::string& str_id)													{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopup(str_id.c_str()), Popup); }
+	inline bool BeginPopup(const std::string& str_id, int flags)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopup(str_id.c_str(), static_cast<ImGuiWindowFlags>(flags)), Popup); }
+	inline bool BeginPopupModal(const std::string& name)												{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupModal(name.c_str()), Popup); }
+	inline bool BeginPopupModal(const std::string& name, bool open)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupModal(name.c_str(), &open), Popup); }
+	inline bool BeginPopupModal(const std::string& name, bool open, int flags)							{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupModal(name.c_str(), &open, static_cast<ImGuiWindowFlags>(flags)), Popup); }
+	inline void EndPopup()																				{ SOL_IMGUI_STACK_POP(Popup, 1); ImGui::EndPopup(); }
+	inline void OpenPopup(const std::string& str_id)													{ ImGui::OpenPopup(str_id.c_str()); }
+	inline void OpenPopup(const std::string& str_id, int popup_flags)									{ ImGui::OpenPopup(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
+	inline void CloseCurrentPopup()																		{ ImGui::CloseCurrentPopup(); }
+	inline bool BeginPopupContextItem()																	{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextItem(), Popup); }
+	inline bool BeginPopupContextItem(const std::string& str_id)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextItem(str_id.c_str()), Popup); }
+	inline bool BeginPopupContextItem(const std::string& str_id, int popup_flags)						{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextItem(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)), Popup); }
+	inline bool BeginPopupContextWindow()																{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextWindow(), Popup); }
+	inline bool BeginPopupContextWindow(const std::string& str_id)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextWindow(str_id.c_str()), Popup); }
+	inline bool BeginPopupContextWindow(const std::string& str_id, int popup_flags)						{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextWindow(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)), Popup); }
+	inline bool BeginPopupContextVoid()																	{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextVoid(), Popup); }
+	inline bool BeginPopupContextVoid(const std::string& str_id)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextVoid(str_id.c_str()), Popup); }
+	inline bool BeginPopupContextVoid(const std::string& str_id, int popup_flags)						{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginPopupContextVoid(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)), Popup); }
+	inline bool IsPopupOpen(const std::string& str_id)													{ return ImGui::IsPopupOpen(str_id.c_str()); }
+	inline bool IsPopupOpen(const std::string& str_id, int popup_flags)									{ return ImGui::IsPopupOpen(str_id.c_str(), popup_flags); }
+
+	// Columns
+	inline void Columns()																				{ ImGui::Columns(); }
+	inline void Columns(int count)																		{ ImGui::Columns(count); }
+	inline void Columns(int count, const std::string& id)												{ ImGui::Columns(count, id.c_str()); }
+	inline void Columns(int count, const std::string& id, bool border)									{ ImGui::Columns(count, id.c_str(), border); }
+	inline void NextColumn()																			{ ImGui::NextColumn(); }
+	inline int GetColumnIndex()																			{ return ImGui::GetColumnIndex(); }
+	inline float GetColumnWidth()																		{ return ImGui::GetColumnWidth(); }
+	inline float GetColumnWidth(int column_index)														{ return ImGui::GetColumnWidth(column_index); }
+	inline void SetColumnWidth(int column_index, float width)											{ ImGui::SetColumnWidth(column_index, width); }
+	inline float GetColumnOffset()																		{ return ImGui::GetColumnOffset(); }
+	inline float GetColumnOffset(int column_index)														{ return ImGui::GetColumnOffset(column_index); }
+	inline void SetColumnOffset(int column_index, float offset_x)										{ ImGui::SetColumnOffset(column_index, offset_x); }
+	inline int GetColumnsCount()																		{ return ImGui::GetColumnsCount(); }
+
+	// Tab Bars, Tabs
+	inline bool BeginTabBar(const std::string& str_id)													{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginTabBar(str_id.c_str()), TabBar); }
+	inline bool BeginTabBar(const std::string& str_id, int flags)										{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginTabBar(str_id.c_str(), static_cast<ImGuiTabBarFlags>(flags)), TabBar); }
+	inline void EndTabBar()																				{ SOL_IMGUI_STACK_POP(TabBar, 1); ImGui::EndTabBar(); }
+	inline bool BeginTabItem(const std::string& label)													{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginTabItem(label.c_str()), TabItem); }
+	inline std::tuple<bool, bool> BeginTabItem(const std::string& label, bool open)						{ bool selected = SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginTabItem(label.c_str(), &open), TabItem); return std::make_tuple(open, selected); }
+	inline std::tuple<bool, bool> BeginTabItem(const std::string& label, bool open, int flags)			{ bool selected = SOL_IMGUI_STACK_PUSH_IF(ImGui::BeginTabItem(label.c_str(), &open, static_cast<ImGuiTabItemFlags>(flags)), TabItem); return std::make_tuple(open, selected); }
+	inline void EndTabItem()																			{ SOL_IMGUI_STACK_POP(TabItem, 1); ImGui::EndTabItem(); }
+	inline void SetTabItemClosed(const std::string& tab_or_docked_window_label)							{ ImGui::SetTabItemClosed(tab_or_docked_window_label.c_str()); }
+
+	// Docking
+	#ifndef IMGUI_NO_DOCKING	// Define IMGUI_NO_DOCKING to disable these for compatibility with ImGui's master branch
+	inline void DockSpace(unsigned int id)																{ ImGui::DockSpace(id); }
+	inline void DockSpace(unsigned int id, float sizeX, float sizeY)									{ ImGui::DockSpace(id, { sizeX, sizeY }); }
+	inline void DockSpace(unsigned int id, float sizeX, float sizeY, int flags)							{ ImGui::DockSpace(id, { sizeX, sizeY }, static_cast<ImGuiDockNodeFlags>(flags)); }
+	inline unsigned int DockSpaceOverViewport()															{ return 0; /* TODO: DockSpaceOverViwport(...) ==> UNSUPPORTED */ }
+	inline void SetNextWindowDockID(unsigned int dock_id)												{ ImGui::SetNextWindowDockID(dock_id); }
+	inline void SetNextWindowDockID(unsigned int dock_id, int cond)										{ ImGui::SetNextWindowDockID(dock_id, static_cast<ImGuiCond>(cond)); }
+	inline void SetNextWindowClass()																	{  /* TODO: SetNextWindowClass(...) ==> UNSUPPORTED */ }
+	inline unsigned int GetWindowDockID()																{ return ImGui::GetWindowDockID(); }
+	inline bool IsWindowDocked()																		{ return ImGui::IsWindowDocked(); }
+	#endif
+
+	// Logging
+	inline void LogToTTY()																				{ ImGui::LogToTTY(); }
+	inline void LogToTTY(int auto_open_depth)															{ ImGui::LogToTTY(auto_open_depth); }
+	inline void LogToFile()																				{ ImGui::LogToFile(); }
+	inline void LogToFile(int auto_open_depth)															{ ImGui::LogToFile(auto_open_depth); }
+	inline void LogToFile(int auto_open_depth, const std::string& filename)								{ ImGui::LogToFile(auto_open_depth, filename.c_str()); }
+	inline void LogToClipboard()																		{ ImGui::LogToClipboard(); }
+	inline void LogToClipboard(int auto_open_depth)														{ ImGui::LogToClipboard(auto_open_depth); }
+	inline void LogFinish()																				{ ImGui::LogFinish(); }
+	inline void LogButtons()																			{ ImGui::LogButtons(); }
+	inline void LogText(const std::string& fmt)															{ ImGui::LogText(fmt.c_str()); }
+
+	// Drag and Drop
+	// TODO: Drag and Drop ==> UNSUPPORTED
+
+	// Clipping
+	inline void PushClipRect(float min_x, float min_y, float max_x, float max_y, bool intersect_current) { ImGui::PushClipRect({ min_x, min_y }, { max_x, max_y }, intersect_current); SOL_IMGUI_STACK_PUSH(ClipRect); }
+	inline void PopClipRect()																			{ SOL_IMGUI_STACK_POP(ClipRect, 1); ImGui::PopClipRect(); }
+
+	// Focus, Activation
+	inline void SetItemDefaultFocus()																	{ ImGui::SetItemDefaultFocus(); }
+	inline void SetKeyboardFocusHere()																	{ ImGui::SetKeyboardFocusHere(); }
+	inline void SetKeyboardFocusHere(int offset)														{ ImGui::SetKeyboardFocusHere(offset); }
+
+	// Item/Widgets Utilities
+	inline bool IsItemHovered()																			{ return ImGui::IsItemHovered(); }
+	inline bool IsItemHovered(int flags)																{ return ImGui::IsItemHovered(static_cast<ImGuiHoveredFlags>(flags)); }
+	inline bool IsItemActive()																			{ return ImGui::IsItemActive(); }
+	inline bool IsItemFocused()																			{ return ImGui::IsItemFocused(); }
+	inline bool IsItemClicked()																			{ return ImGui::IsItemClicked(); }
+	inline bool IsItemClicked(int mouse_button)															{ return ImGui::IsItemClicked(static_cast<ImGuiMouseButton>(mouse_button)); }
+	inline bool IsItemVisible()																			{ return ImGui::IsItemVisible(); }
+	inline bool IsItemEdited()																			{ return ImGui::IsItemEdited(); }
+	inline bool IsItemActivated()																		{ return ImGui::IsItemActivated(); }
+	inline bool IsItemDeactivated()																		{ return ImGui::IsItemDeactivated(); }
+	inline bool IsItemDeactivatedAfterEdit()															{ return ImGui::IsItemDeactivatedAfterEdit(); }
+	inline bool IsItemToggledOpen()																		{ return ImGui::IsItemToggledOpen(); }
+	inline bool IsAnyItemHovered()																		{ return ImGui::IsAnyItemHovered(); }
+	inline bool IsAnyItemActive()																		{ return ImGui::IsAnyItemActive(); }
+	inline bool IsAnyItemFocused()																		{ return ImGui::IsAnyItemFocused(); }
+	inline std::tuple<float, float> GetItemRectMin()													{ const auto vec2{ ImGui::GetItemRectMin() }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetItemRectMax()													{ const auto vec2{ ImGui::GetItemRectMax() }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetItemRectSize()													{ const auto vec2{ ImGui::GetItemRectSize() }; return std::make_tuple(vec2.x, vec2.y); }
+	inline void SetNextItemAllowOverlap()																{ ImGui::SetNextItemAllowOverlap(); }
+
+	// Miscellaneous Utilities
+	inline bool IsRectVisible(float sizeX, float sizeY)													{ return ImGui::IsRectVisible({ sizeX, sizeY }); }
+	inline bool IsRectVisible(float minX, float minY, float maxX, float maxY)							{ return ImGui::IsRectVisible({ minX, minY }, { maxX, maxY }); }
+	inline double GetTime()																				{ return ImGui::GetTime(); }
+	inline int GetFrameCount()																			{ return ImGui::GetFrameCount(); }
+	/* TODO: GetBackgroundDrawList(), GetForeGroundDrawList(), GetDrawListSharedData() ==> UNSUPPORTED */
+	inline std::string GetStyleColorName(int idx)														{ return std::string(ImGui::GetStyleColorName(static_cast<ImGuiCol>(idx))); }
+	/* TODO: SetStateStorage(), GetStateStorage(), CalcListClipping() ==> UNSUPPORTED */
+	//inline bool BeginChild(unsigned int id, float sizeX, float sizeY)								{ return ImGui::BeginChild(id, { sizeX, sizeY }); }
+	//inline bool BeginChild(unsigned int id, float sizeX, float sizeY, int flags)					{ return ImGui::BeginChild(id, { sizeX, sizeY }, static_cast<ImGuiWindowFlags>(flags)); }
+	//inline void EndChild()																			{ return ImGui::EndChild(); }
+
+	// Text Utilities
+	inline std::tuple<float, float> CalcTextSize(const std::string& text)																					{ const auto vec2{ ImGui::CalcTextSize(text.c_str()) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end)														{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str()) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end, bool hide_text_after_double_hash)					{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end, bool hide_text_after_double_hash, float wrap_width)	{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash, wrap_width) }; return std::make_tuple(vec2.x, vec2.y); }
+
+	// Color Utilities
+	inline sol::as_table_t<std::vector<float>> ColorConvertU32ToFloat4(unsigned int in)
+	{
+		const auto vec4 = ImGui::ColorConvertU32ToFloat4(in);
+		sol::as_table_t rgba = sol::as_table(std::vector<float>{
+			vec4.x, vec4.y, vec4.z, vec4.w
+		});
+
+		return rgba;
+	}
+	inline unsigned int ColorConvertFloat4ToU32(const sol::table& rgba)
+	{
+		const lua_Number	r{ rgba[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							g{ rgba[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							b{ rgba[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
+							a{ rgba[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
+		
+		return ImGui::ColorConvertFloat4ToU32({ float(r), float(g), float(b), float(a) });
+	}
+
+	inline std::tuple<float, float, float> ColorConvertRGBtoHSV(float r, float g, float b)
+	{
+		float h{}, s{}, v{};
+		ImGui::ColorConvertRGBtoHSV(r, g, b, h, s, v);
+		return std::make_tuple(h, s, v);
+	}
+	inline std::tuple<float, float, float> ColorConvertHSVtoRGB(float h, float s, float v)
+	{
+		float r{}, g{}, b{};
+		ImGui::ColorConvertHSVtoRGB(h, s, v, r, g, b);
+		return std::make_tuple(r, g, b);
+	}
+
+	// Inputs Utilities: Keyboard
+	//inline int GetKeyIndex(int imgui_key)																{ return ImGui::GetKeyIndex(static_cast<ImGuiKey>(imgui_key)); }
+	inline bool IsKeyDown(int user_key_index)															{ return ImGui::IsKeyDown((ImGuiKey)user_key_index); }
+	inline bool IsKeyPressed(int user_key_index)														{ return ImGui::IsKeyPressed((ImGuiKey)user_key_index); }
+	inline bool IsKeyPressed(int user_key_index, bool repeat)											{ return ImGui::IsKeyPressed((ImGuiKey)user_key_index, repeat); }
+	inline bool IsKeyReleased(int user_key_index)														{ return ImGui::IsKeyReleased((ImGuiKey)user_key_index); }
+	inline int GetKeyPressedAmount(int key_index, float repeat_delay, float rate)						{ return ImGui::GetKeyPressedAmount((ImGuiKey)key_index, repeat_delay, rate); }
+	inline void SetNextFrameWantCaptureKeyboard(bool want_capture_keyboard_value)						{ ImGui::SetNextFrameWantCaptureKeyboard(want_capture_keyboard_value); }
+
+	// Inputs Utilities: Mouse
+	inline bool IsMouseDown(int button)																	{ return ImGui::IsMouseDown(static_cast<ImGuiMouseButton>(button)); }
+	inline bool IsMouseClicked(int button)																{ return ImGui::IsMouseClicked(static_cast<ImGuiMouseButton>(button)); }
+	inline bool IsMouseClicked(int button, bool repeat)													{ return ImGui::IsMouseClicked(static_cast<ImGuiMouseButton>(button), repeat); }
+	inline bool IsMouseReleased(int button)																{ return ImGui::IsMouseReleased(static_cast<ImGuiMouseButton>(button)); }
+	inline bool IsMouseDoubleClicked(int button)														{ return ImGui::IsMouseDoubleClicked(static_cast<ImGuiMouseButton>(button)); }
+	inline bool IsMouseHoveringRect(float min_x, float min_y, float max_x, float max_y)					{ return ImGui::IsMouseHoveringRect({ min_x, min_y }, { max_x, max_y }); }
+	inline bool IsMouseHoveringRect(float min_x, float min_y, float max_x, float max_y, bool clip)		{ return ImGui::IsMouseHoveringRect({ min_x, min_y }, { max_x, max_y }, clip); }
+	inline bool IsMousePosValid()																		{ return false; /* TODO: IsMousePosValid() ==> UNSUPPORTED */ }
+	inline bool IsAnyMouseDown()																		{ return ImGui::IsAnyMouseDown(); }
+	inline std::tuple<float, float> GetMousePos()														{ const auto vec2{ ImGui::GetMousePos() }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetMousePosOnOpeningCurrentPopup()									{ const auto vec2{ ImGui::GetMousePosOnOpeningCurrentPopup() }; return std::make_tuple(vec2.x, vec2.y); }
+	inline bool IsMouseDragging(int button)																{ return ImGui::IsMouseDragging(static_cast<ImGuiMouseButton>(button)); }
+	inline bool IsMouseDragging(int button, float lock_threshold)										{ return ImGui::IsMouseDragging(static_cast<ImGuiMouseButton>(button), lock_threshold); }
+	inline std::tuple<float, float> GetMouseDragDelta()													{ const auto vec2{ ImGui::GetMouseDragDelta() }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetMouseDragDelta(int button)										{ const auto vec2{ ImGui::GetMouseDragDelta(static_cast<ImGuiMouseButton>(button)) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline std::tuple<float, float> GetMouseDragDelta(int button, float lock_threshold)					{ const auto vec2{ ImGui::GetMouseDragDelta(static_cast<ImGuiMouseButton>(button), lock_threshold) }; return std::make_tuple(vec2.x, vec2.y); }
+	inline void ResetMouseDragDelta()																	{ ImGui::ResetMouseDragDelta(); }
+	inline void ResetMouseDragDelta(int button)															{ ImGui::ResetMouseDragDelta(static_cast<ImGuiMouseButton>(button)); }
+	inline int GetMouseCursor()																			{ return ImGui::GetMouseCursor(); }
+	inline void SetMouseCursor(int cursor_type)															{ ImGui::SetMouseCursor(static_cast<ImGuiMouseCursor>(cursor_type)); }
+	inline void SetNextFrameWantCaptureMouse(bool want_capture_mouse) { ImGui::SetNextFrameWantCaptureMouse(want_capture_mouse); }
+
+	// Clipboard Utilities
+	inline std::string GetClipboardText()																{ return std::string(ImGui::GetClipboardText()); }
+	inline void SetClipboardText(const std::string& text)												{ ImGui::SetClipboardText(text.c_str()); }
+	
+#pragma region Frame Replayer
+#ifdef SOL_IMGUI_ENABLE_RECORDER
+	struct ReplayFrameStats
+	{
+		std::uint32_t									frame{};
+		std::size_t										calls{};
+		std::size_t										replayed{};
+		double											milliseconds{};	// from ImGui::NewFrame() to ImGui::Render() included
+		std::unordered_map<std::string, std::size_t>	skipped;		// calls without a matching replay handler, by binding name
+	};
+
+	namespace detail
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::SliderFloat4(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		using ReplayHandler = std::function<bool(const std::vector<RecordedValue>& arguments)>;
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		template <typename T>
+		inline bool ReplayAccepts(const RecordedValue& value)
+		{
+			if constexpr (std::is_same_v<T, bool>)			return value.type == RecordedType::Boolean;
+			else if constexpr (std::is_arithmetic_v<T>)		return value.type == RecordedType::Number;
+			else											return value.type == RecordedType::String;
+		}
+		template <typename T>
+		inline T ReplayConvert(const RecordedValue& value)
+		{
+			if constexpr (std::is_same_v<T, bool>)			return value.number != 0.0;
+			else if constexpr (std::is_arithmetic_v<T>)		return static_cast<T>(value.number);
+			else											return value.string;
+		}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad)																									{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min)																				{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max)															{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max, const std::string& format)								{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max, format.c_str()); return std::make_tuple(v_rad, used); }
-	inline std::tuple<float, bool> SliderAngle(const std::string& label, float v_rad, float v_degrees_min, float v_degrees_max, const std::string& format, int flags)					{ bool used = ImGui::SliderAngle(label.c_str(), &v_rad, v_degrees_min, v_degrees_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v_rad, used); }
-	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max)																						{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max, const std::string& format)															{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> SliderInt(const std::string& label, int v, int v_min, int v_max, const std::string& format, int flags)													{ bool used = ImGui::SliderInt(label.c_str(), &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max);
+		template <typename R, typename... Args, std::size_t... I>
+		inline bool TryReplay(R(*function)(Args...), const std::vector<RecordedValue>& arguments, std::index_sequence<I...>)
+		{
+			if (!(ReplayAccepts<std::decay_t<Args>>(arguments[I]) && ...)) return false;
+			function(ReplayConvert<std::decay_t<Args>>(arguments[I])...);
+			return true;
+		}
+		template <typename R, typename... Args>
+		inline bool TryReplay(R(*function)(Args...), const std::vector<RecordedValue>& arguments)
+		{
+			return arguments.size() == sizeof...(Args) && TryReplay(function, arguments, std::index_sequence_for<Args...>{});
+		}
+		inline bool TryReplay(bool(*handler)(const std::vector<RecordedValue>&), const std::vector<RecordedValue>& arguments)	{ return handler(arguments); }
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+		// Replays with the first overload whose parameters match the recorded arguments, in the order sol::overload tries them
+		template <typename... Functions>
+		inline ReplayHandler ReplayOverloads(Functions... functions)
+		{
+			return [=](const std::vector<RecordedValue>& arguments) { return (TryReplay(functions, arguments) || ...); };
+		}
 
-		return std::make_tuple(int2, used);
+		// Combo and ListBox over a table of strings
+		template <bool IsCombo>
+		inline bool ReplayItemList(const std::vector<RecordedValue>& arguments)
+		{
+			if ((arguments.size() != 4 && arguments.size() != 5) || arguments[0].type != RecordedType::String || arguments[1].type != RecordedType::Number ||
+				arguments[2].type != RecordedType::Table || arguments[3].type != RecordedType::Number)
+				return false;
+
+			const auto& elements{ arguments[2].elements };
+			const int itemsCount{ std::max(static_cast<int>(arguments[3].number), 0) };
+			std::vector<const char*> items;
+			for (int i = 0; i < itemsCount; i++)
+				items.push_back(i < static_cast<int>(elements.size()) && elements[i].type == RecordedType::String ? elements[i].string.c_str() : "Missing");
+
+			int currentItem{ static_cast<int>(arguments[1].number) };
+			const int height{ arguments.size() == 5 ? static_cast<int>(arguments[4].number) : -1 };
+			if constexpr (IsCombo)	ImGui::Combo(arguments[0].string.c_str(), &currentItem, items.data(), itemsCount, height);
+			else					ImGui::ListBox(arguments[0].string.c_str(), &currentItem, items.data(), itemsCount, height);
+			return true;
+		}
+
+		inline const std::unordered_map<std::string, ReplayHandler>& ReplayHandlers()
+		{
+			static const std::unordered_map<std::string, ReplayHandler> handlers
+			{
+				{ "Begin", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(Begin),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(Begin),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(Begin)
+				) },
+				{ "End", ReplayOverloads(sol::resolve<void()>(End)) },
+				{ "BeginChild", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(BeginChild),
+					sol::resolve<bool(const std::string&, float)>(BeginChild),
+					sol::resolve<bool(const std::string&, float, float)>(BeginChild),
+					sol::resolve<bool(const std::string&, float, float, int)>(BeginChild),
+					sol::resolve<bool(const std::string&, float, float, int, int)>(BeginChild)
+				) },
+				{ "EndChild", ReplayOverloads(sol::resolve<void()>(EndChild)) },
+				{ "SetNextWindowPos", ReplayOverloads(
+					sol::resolve<void(float, float)>(SetNextWindowPos),
+					sol::resolve<void(float, float, int)>(SetNextWindowPos),
+					sol::resolve<void(float, float, int, float, float)>(SetNextWindowPos)
+				) },
+				{ "SetNextWindowSize", ReplayOverloads(
+					sol::resolve<void(float, float)>(SetNextWindowSize),
+					sol::resolve<void(float, float, int)>(SetNextWindowSize)
+				) },
+				{ "SetNextWindowCollapsed", ReplayOverloads(
+					sol::resolve<void(bool)>(SetNextWindowCollapsed),
+					sol::resolve<void(bool, int)>(SetNextWindowCollapsed)
+				) },
+				{ "SetNextWindowBgAlpha", ReplayOverloads(sol::resolve<void(float)>(SetNextWindowBgAlpha)) },
+				{ "PushStyleColor", ReplayOverloads(
+					sol::resolve<void(int, int)>(PushStyleColor),
+					sol::resolve<void(int, float, float, float, float)>(PushStyleColor)
+				) },
+				{ "PopStyleColor", ReplayOverloads(
+					sol::resolve<void()>(PopStyleColor),
+					sol::resolve<void(int)>(PopStyleColor)
+				) },
+				{ "PushStyleVar", ReplayOverloads(
+					sol::resolve<void(int, float)>(PushStyleVar),
+					sol::resolve<void(int, float, float)>(PushStyleVar)
+				) },
+				{ "PopStyleVar", ReplayOverloads(
+					sol::resolve<void()>(PopStyleVar),
+					sol::resolve<void(int)>(PopStyleVar)
+				) },
+				{ "PushItemWidth", ReplayOverloads(sol::resolve<void(float)>(PushItemWidth)) },
+				{ "PopItemWidth", ReplayOverloads(sol::resolve<void()>(PopItemWidth)) },
+				{ "SetNextItemWidth", ReplayOverloads(sol::resolve<void(float)>(SetNextItemWidth)) },
+				{ "PushTextWrapPos", ReplayOverloads(
+					sol::resolve<void()>(PushTextWrapPos),
+					sol::resolve<void(float)>(PushTextWrapPos)
+				) },
+				{ "PopTextWrapPos", ReplayOverloads(sol::resolve<void()>(PopTextWrapPos)) },
+				{ "Separator", ReplayOverloads(sol::resolve<void()>(Separator)) },
+				{ "SameLine", ReplayOverloads(
+					sol::resolve<void()>(SameLine),
+					sol::resolve<void(float)>(SameLine),
+					sol::resolve<void(float, float)>(SameLine)
+				) },
+				{ "NewLine", ReplayOverloads(sol::resolve<void()>(NewLine)) },
+				{ "Spacing", ReplayOverloads(sol::resolve<void()>(Spacing)) },
+				{ "Dummy", ReplayOverloads(sol::resolve<void(float, float)>(Dummy)) },
+				{ "Indent", ReplayOverloads(
+					sol::resolve<void()>(Indent),
+					sol::resolve<void(float)>(Indent)
+				) },
+				{ "Unindent", ReplayOverloads(
+					sol::resolve<void()>(Unindent),
+					sol::resolve<void(float)>(Unindent)
+				) },
+				{ "BeginGroup", ReplayOverloads(sol::resolve<void()>(BeginGroup)) },
+				{ "EndGroup", ReplayOverloads(sol::resolve<void()>(EndGroup)) },
+				{ "SetCursorPos", ReplayOverloads(sol::resolve<void(float, float)>(SetCursorPos)) },
+				{ "SetCursorPosX", ReplayOverloads(sol::resolve<void(float)>(SetCursorPosX)) },
+				{ "SetCursorPosY", ReplayOverloads(sol::resolve<void(float)>(SetCursorPosY)) },
+				{ "AlignTextToFramePadding", ReplayOverloads(sol::resolve<void()>(AlignTextToFramePadding)) },
+				{ "PushID", ReplayOverloads(
+					sol::resolve<void(const std::string&)>(PushID),
+					sol::resolve<void(const std::string&, const std::string&)>(PushID),
+					sol::resolve<void(int)>(PushID)
+				) },
+				{ "PopID", ReplayOverloads(sol::resolve<void()>(PopID)) },
+				{ "TextUnformatted", ReplayOverloads(
+					sol::resolve<void(const std::string&)>(TextUnformatted),
+					sol::resolve<void(const std::string&, const std::string&)>(TextUnformatted)
+				) },
+				{ "Text", ReplayOverloads(sol::resolve<void(const std::string&)>(Text)) },
+				{ "TextColored", ReplayOverloads(sol::resolve<void(float, float, float, float, const std::string&)>(TextColored)) },
+				{ "TextDisabled", ReplayOverloads(sol::resolve<void(const std::string&)>(TextDisabled)) },
+				{ "TextWrapped", ReplayOverloads(sol::resolve<void(const std::string)>(TextWrapped)) },
+				{ "LabelText", ReplayOverloads(sol::resolve<void(const std::string&, const std::string&)>(LabelText)) },
+				{ "BulletText", ReplayOverloads(sol::resolve<void(const std::string&)>(BulletText)) },
+				{ "Button", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(Button),
+					sol::resolve<bool(const std::string&, float, float)>(Button)
+				) },
+				{ "SmallButton", ReplayOverloads(sol::resolve<bool(const std::string&)>(SmallButton)) },
+				{ "InvisibleButton", ReplayOverloads(sol::resolve<bool(const std::string&, float, float)>(InvisibleButton)) },
+				{ "ArrowButton", ReplayOverloads(sol::resolve<bool(const std::string&, int)>(ArrowButton)) },
+				{ "Checkbox", ReplayOverloads(sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(Checkbox)) },
+				{ "RadioButton", ReplayOverloads(
+					sol::resolve<bool(const std::string&, bool)>(RadioButton),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int)>(RadioButton)
+				) },
+				{ "ProgressBar", ReplayOverloads(
+					sol::resolve<void(float)>(ProgressBar),
+					sol::resolve<void(float, float, float)>(ProgressBar),
+					sol::resolve<void(float, float, float, const std::string&)>(ProgressBar)
+				) },
+				{ "Bullet", ReplayOverloads(sol::resolve<void()>(Bullet)) },
+				{ "BeginCombo", ReplayOverloads(
+					sol::resolve<bool(const std::string&, const std::string&)>(BeginCombo),
+					sol::resolve<bool(const std::string&, const std::string&, int)>(BeginCombo)
+				) },
+				{ "EndCombo", ReplayOverloads(sol::resolve<void()>(EndCombo)) },
+				{ "Combo", ReplayOverloads(
+					ReplayItemList<true>,
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, const std::string&)>(Combo),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, const std::string&, int)>(Combo)
+				) },
+				{ "ListBox", ReplayOverloads(ReplayItemList<false>) },
+				{ "DragFloat", ReplayOverloads(
+					sol::resolve<std::tuple<float, bool>(const std::string&, float)>(DragFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float)>(DragFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(DragFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float)>(DragFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, const std::string&)>(DragFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, float, const std::string&, int)>(DragFloat)
+				) },
+				{ "DragInt", ReplayOverloads(
+					sol::resolve<std::tuple<int, bool>(const std::string&, int)>(DragInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, float)>(DragInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int)>(DragInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int, int)>(DragInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int, int, const std::string&)>(DragInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, float, int, int, const std::string&, int)>(DragInt)
+				) },
+				{ "SliderFloat", ReplayOverloads(
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(SliderFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&)>(SliderFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&, int)>(SliderFloat)
+				) },
+				{ "SliderAngle", ReplayOverloads(
+					sol::resolve<std::tuple<float, bool>(const std::string&, float)>(SliderAngle),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float)>(SliderAngle),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(SliderAngle),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&)>(SliderAngle),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&, int)>(SliderAngle)
+				) },
+				{ "SliderInt", ReplayOverloads(
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int)>(SliderInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int, const std::string&)>(SliderInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int, const std::string&, int)>(SliderInt)
+				) },
+				{ "InputText", ReplayOverloads(
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string)>(InputText),
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, int)>(InputText)
+				) },
+				{ "InputTextMultiline", ReplayOverloads(
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string)>(InputTextMultiline),
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, float, float)>(InputTextMultiline),
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, std::string, float, float, int)>(InputTextMultiline)
+				) },
+				{ "InputTextWithHint", ReplayOverloads(
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, const std::string&, std::string)>(InputTextWithHint),
+					sol::resolve<std::tuple<std::string, bool>(const std::string&, const std::string&, std::string, int)>(InputTextWithHint)
+				) },
+				{ "InputFloat", ReplayOverloads(
+					sol::resolve<std::tuple<float, bool>(const std::string&, float)>(InputFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float)>(InputFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float)>(InputFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&)>(InputFloat),
+					sol::resolve<std::tuple<float, bool>(const std::string&, float, float, float, const std::string&, int)>(InputFloat)
+				) },
+				{ "InputInt", ReplayOverloads(
+					sol::resolve<std::tuple<int, bool>(const std::string&, int)>(InputInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int)>(InputInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int)>(InputInt),
+					sol::resolve<std::tuple<int, bool>(const std::string&, int, int, int, int)>(InputInt)
+				) },
+				{ "InputDouble", ReplayOverloads(
+					sol::resolve<std::tuple<double, bool>(const std::string&, double)>(InputDouble),
+					sol::resolve<std::tuple<double, bool>(const std::string&, double, double)>(InputDouble),
+					sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double)>(InputDouble),
+					sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double, const std::string&)>(InputDouble),
+					sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double, const std::string&, int)>(InputDouble)
+				) },
+				{ "TreeNode", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(TreeNode),
+					sol::resolve<bool(const std::string&, const std::string&)>(TreeNode)
+				) },
+				{ "TreeNodeEx", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(TreeNodeEx),
+					sol::resolve<bool(const std::string&, int)>(TreeNodeEx),
+					sol::resolve<bool(const std::string&, int, const std::string&)>(TreeNodeEx)
+				) },
+				{ "TreePush", ReplayOverloads(sol::resolve<void(const std::string&)>(TreePush)) },
+				{ "TreePop", ReplayOverloads(sol::resolve<void()>(TreePop)) },
+				{ "CollapsingHeader", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(CollapsingHeader),
+					sol::resolve<bool(const std::string&, int)>(CollapsingHeader),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(CollapsingHeader),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(CollapsingHeader)
+				) },
+				{ "SetNextItemOpen", ReplayOverloads(
+					sol::resolve<void(bool)>(SetNextItemOpen),
+					sol::resolve<void(bool, int)>(SetNextItemOpen)
+				) },
+				{ "Selectable", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(Selectable),
+					sol::resolve<bool(const std::string&, bool)>(Selectable),
+					sol::resolve<bool(const std::string&, bool, int)>(Selectable),
+					sol::resolve<bool(const std::string&, bool, int, float, float)>(Selectable)
+				) },
+				{ "BeginListBox", ReplayOverloads(
+					sol::resolve<bool(const std::string&, float, float)>(BeginListBox),
+					sol::resolve<bool(const std::string&)>(BeginListBox)
+				) },
+				{ "EndListBox", ReplayOverloads(sol::resolve<void()>(EndListBox)) },
+				{ "Value", ReplayOverloads(
+					sol::resolve<void(const std::string&, bool)>(Value),
+					sol::resolve<void(const std::string&, int)>(Value),
+					sol::resolve<void(const std::string&, unsigned int)>(Value),
+					sol::resolve<void(const std::string&, float)>(Value),
+					sol::resolve<void(const std::string&, float, const std::string&)>(Value)
+				) },
+				{ "BeginMenuBar", ReplayOverloads(sol::resolve<bool()>(BeginMenuBar)) },
+				{ "EndMenuBar", ReplayOverloads(sol::resolve<void()>(EndMenuBar)) },
+				{ "BeginMainMenuBar", ReplayOverloads(sol::resolve<bool()>(BeginMainMenuBar)) },
+				{ "EndMainMenuBar", ReplayOverloads(sol::resolve<void()>(EndMainMenuBar)) },
+				{ "BeginMenu", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(BeginMenu),
+					sol::resolve<bool(const std::string&, bool)>(BeginMenu)
+				) },
+				{ "EndMenu", ReplayOverloads(sol::resolve<void()>(EndMenu)) },
+				{ "MenuItem", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(MenuItem),
+					sol::resolve<bool(const std::string&, const std::string&)>(MenuItem),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, const std::string&, bool)>(MenuItem),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, const std::string&, bool, bool)>(MenuItem)
+				) },
+				{ "BeginTooltip", ReplayOverloads(sol::resolve<void()>(BeginTooltip)) },
+				{ "EndTooltip", ReplayOverloads(sol::resolve<void()>(EndTooltip)) },
+				{ "SetTooltip", ReplayOverloads(sol::resolve<void(const std::string&)>(SetTooltip)) },
+				{ "BeginPopup", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(BeginPopup),
+					sol::resolve<bool(const std::string&, int)>(BeginPopup)
+				) },
+				{ "BeginPopupModal", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(BeginPopupModal),
+					sol::resolve<bool(const std::string&, bool)>(BeginPopupModal),
+					sol::resolve<bool(const std::string&, bool, int)>(BeginPopupModal)
+				) },
+				{ "EndPopup", ReplayOverloads(sol::resolve<void()>(EndPopup)) },
+				{ "OpenPopup", ReplayOverloads(
+					sol::resolve<void(const std::string&)>(OpenPopup),
+					sol::resolve<void(const std::string&, int)>(OpenPopup)
+				) },
+				{ "CloseCurrentPopup", ReplayOverloads(sol::resolve<void()>(CloseCurrentPopup)) },
+				{ "Columns", ReplayOverloads(
+					sol::resolve<void()>(Columns),
+					sol::resolve<void(int)>(Columns),
+					sol::resolve<void(int, const std::string&)>(Columns),
+					sol::resolve<void(int, const std::string&, bool)>(Columns)
+				) },
+				{ "NextColumn", ReplayOverloads(sol::resolve<void()>(NextColumn)) },
+				{ "BeginTabBar", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(BeginTabBar),
+					sol::resolve<bool(const std::string&, int)>(BeginTabBar)
+				) },
+				{ "EndTabBar", ReplayOverloads(sol::resolve<void()>(EndTabBar)) },
+				{ "BeginTabItem", ReplayOverloads(
+					sol::resolve<bool(const std::string&)>(BeginTabItem),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(BeginTabItem),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(BeginTabItem)
+				) },
+				{ "EndTabItem", ReplayOverloads(sol::resolve<void()>(EndTabItem)) },
+				{ "PushClipRect", ReplayOverloads(sol::resolve<void(float, float, float, float, bool)>(PushClipRect)) },
+				{ "PopClipRect", ReplayOverloads(sol::resolve<void()>(PopClipRect)) }
+			};
+			return handlers;
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+
+	// Replays a FrameRecorder recording against the current ImGui context without Lua. Each frame feeds the recorded
+	// input, then runs ImGui::NewFrame(), the recorded calls through the sol_ImGui wrappers and ImGui::Render().
+	class FrameReplayer
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max, format.c_str());
+	public:
+		explicit FrameReplayer(const std::string& path)
+		{
+			std::FILE* file{ std::fopen(path.c_str(), "rb") };
+			if (!file) return;
+			char chunk[4096];
+			std::size_t read;
+			while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) data.append(chunk, read);
+			std::fclose(file);
+
+			std::uint32_t version{};
+			valid = data.compare(0, sizeof(RecordingMagic), RecordingMagic, sizeof(RecordingMagic)) == 0;
+			cursor = sizeof(RecordingMagic);
+			valid = valid && Read(version) && version == RecordingVersion;
+		}
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+		bool IsValid() const																	{ return valid; }
+		bool AtEnd() const																		{ return !valid || cursor >= data.size(); }
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt2(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::SliderInt2(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		// Returns false once the recording is exhausted or found malformed
+		bool ReplayFrame(ReplayFrameStats* stats = nullptr)
+		{
+			ReplayFrameStats localStats;
+			ReplayFrameStats& frameStats{ stats ? *stats : localStats };
+			frameStats = {};
+			if (!valid || cursor >= data.size() || data[cursor] != 'F') return false;
+			cursor++;
+			if (!ReadInput(frameStats.frame)) return valid = false;
+
+			const auto start{ std::chrono::steady_clock::now() };
+			ImGui::NewFrame();
+			const auto& handlers{ detail::ReplayHandlers() };
+			while (valid && cursor < data.size() && data[cursor] != 'F')
+			{
+				const char tag{ data[cursor++] };
+				if (tag == 'N')
+				{
+					valid = ReadName();
+					continue;
+				}
+
+				std::uint32_t id{};
+				if (tag != 'C' || !Read(id) || id >= names.size() || !ReadValues(arguments) || !ReadValues(results))
+				{
+					valid = false;
+					break;
+				}
+				frameStats.calls++;
+				const auto handler{ handlers.find(names[id]) };
+				if (handler != handlers.end() && handler->second(arguments))	frameStats.replayed++;
+				else															frameStats.skipped[names[id]]++;
+			}
+			ImGui::Render();
+			frameStats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			return true;
+		}
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+	private:
+		template <typename T>
+		bool Read(T& value)
+		{
+			if (data.size() - cursor < sizeof(T)) return false;
+			std::memcpy(&value, data.data() + cursor, sizeof(T));
+			cursor += sizeof(T);
+			return true;
+		}
+		bool ReadName()
+		{
+			std::uint32_t id{};
+			std::uint16_t length{};
+			if (!Read(id) || id != names.size() || !Read(length) || data.size() - cursor < length) return false;
+			names.emplace_back(data, cursor, length);
+			cursor += length;
+			return true;
+		}
+		bool ReadValue(RecordedValue& value, bool allowTable)
+		{
+			value.number = 0.0;
+			value.string.clear();
+			value.elements.clear();
+			if (!Read(value.type)) return false;
+			switch (value.type)
+			{
+			case RecordedType::Nil:
+				return true;
+			case RecordedType::Boolean:
+			{
+				unsigned char boolean{};
+				if (!Read(boolean)) return false;
+				value.number = boolean ? 1.0 : 0.0;
+				return true;
+			}
+			case RecordedType::Number:
+				return Read(value.number);
+			case RecordedType::String:
+			{
+				std::uint32_t length{};
+				if (!Read(length) || data.size() - cursor < length) return false;
+				value.string.assign(data, cursor, length);
+				cursor += length;
+				return true;
+			}
+			case RecordedType::Table:
+			{
+				std::uint32_t count{};
+				if (!allowTable || !Read(count) || data.size() - cursor < count) return false;
+				value.elements.resize(count);
+				for (auto& element : value.elements)
+					if (!ReadValue(element, false)) return false;
+				return true;
+			}
+			}
+			return false;
+		}
+		bool ReadValues(std::vector<RecordedValue>& values)
+		{
+			unsigned char count{};
+			if (!Read(count)) return false;
+			values.resize(count);
+			for (auto& value : values)
+				if (!ReadValue(value, true)) return false;
+			return true;
+		}
+		bool ReadInput(std::uint32_t& frame)
+		{
+			float deltaTime{}, displayWidth{}, displayHeight{}, mouseX{}, mouseY{}, wheel{}, wheelH{};
+			unsigned char mouseDown{};
+			std::uint16_t keyCount{};
+			if (!Read(frame) || !Read(deltaTime) || !Read(displayWidth) || !Read(displayHeight) || !Read(mouseX) || !Read(mouseY) ||
+				!Read(mouseDown) || !Read(wheel) || !Read(wheelH) || !Read(keyCount))
+				return false;
+
+			ImGuiIO& io{ ImGui::GetIO() };
+			io.DeltaTime = deltaTime > 0.0f ? deltaTime : 1.0f / 60.0f;
+			io.DisplaySize = { displayWidth, displayHeight };
+			io.AddMousePosEvent(mouseX, mouseY);
+			for (int button = 0; button < 5; button++) io.AddMouseButtonEvent(button, (mouseDown >> button) & 1);
+			if (wheel != 0.0f || wheelH != 0.0f) io.AddMouseWheelEvent(wheelH, wheel);
+
+			std::vector<std::uint16_t> keys(keyCount);
+			for (auto& key : keys)
+				if (!Read(key)) return false;
+			for (const auto key : keysDown)
+				if (std::find(keys.begin(), keys.end(), key) == keys.end()) io.AddKeyEvent(static_cast<ImGuiKey>(key), false);
+			for (const auto key : keys) io.AddKeyEvent(static_cast<ImGuiKey>(key), true);
+			keysDown = std::move(keys);
+
+			std::uint16_t characterCount{};
+			if (!Read(characterCount)) return false;
+			for (std::uint16_t i = 0; i < characterCount; i++)
+			{
+				std::uint32_t character{};
+				if (!Read(character)) return false;
+				io.AddInputCharacter(character);
+			}
+			return true;
+		}
 
-		return std::make_tuple(int2, used);
+		std::string						data;
+		std::size_t						cursor{};
+		bool							valid{};
+		std::vector<std::string>		names;		// by recorded id
+		std::vector<std::uint16_t>		keysDown;	// as of the previous replayed frame
+		std::vector<RecordedValue>		arguments;
+		std::vector<RecordedValue>		results;	// recorded results, read past to reach the next call
+	};
+#endif
+#pragma endregion Frame Replayer
+
+#pragma region Script Watchdog
+#ifdef SOL_IMGUI_ENABLE_WATCHDOG	// Define SOL_IMGUI_ENABLE_WATCHDOG to run scripts under a budget and recover the ImGui stacks they leave open
+	namespace detail
+	{
+		// Closes what the wrappers opened above depth, innermost first, through the same wrappers
+		inline std::size_t UnwindStacks(std::size_t depth)
+		{
+			auto& stacks{ Stacks() };
+			std::size_t unwound{};
+			while (stacks.size() > depth)
+			{
+				const std::size_t size{ stacks.size() };
+				switch (stacks.back().kind)
+				{
+				case StackKind::Window:			End(); break;
+				case StackKind::Child:			EndChild(); break;
+				case StackKind::ID:				PopID(); break;
+				case StackKind::StyleColor:		PopStyleColor(); break;
+				case StackKind::StyleVar:		PopStyleVar(); break;
+				case StackKind::Font:			PopFont(); break;
+				case StackKind::Group:			EndGroup(); break;
+				case StackKind::ItemWidth:		PopItemWidth(); break;
+				case StackKind::TextWrapPos:	PopTextWrapPos(); break;
+				case StackKind::Tree:			TreePop(); break;
+				case StackKind::Combo:			EndCombo(); break;
+				case StackKind::ListBox:		EndListBox(); break;
+				case StackKind::MenuBar:		EndMenuBar(); break;
+				case StackKind::MainMenuBar:	EndMainMenuBar(); break;
+				case StackKind::Menu:			EndMenu(); break;
+				case StackKind::Tooltip:		EndTooltip(); break;
+				case StackKind::Popup:			EndPopup(); break;
+				case StackKind::TabBar:			EndTabBar(); break;
+				case StackKind::TabItem:		EndTabItem(); break;
+				case StackKind::ClipRect:		PopClipRect(); break;
+				}
+				if (stacks.size() == size) stacks.pop_back();
+				unwound++;
+			}
+			return unwound;
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max)
+
+	// A zero limit means unlimited
+	struct ScriptBudget
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max);
+		std::uint64_t	instructions{};
+		double			milliseconds{};
+	};
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+	enum class ScriptStatus { Ok, Error, OverBudget };
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+	struct ScriptResult
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max, format.c_str());
+		ScriptStatus	status{ ScriptStatus::Ok };
+		std::string		error;
+		std::uint64_t	instructions{};		// counted in steps of the check interval
+		double			milliseconds{};
+		std::size_t		unwound{};			// ImGui stack entries closed after the script failed
+	};
+
+	// Runs scripts through a count hook that aborts them once over budget. After an error or an abort, the window,
+	// ID, style, font and other stacks the script opened through the wrappers are closed again, so one faulty panel
+	// costs its own output and not the frame. A hook already installed (the sampling profiler) keeps being called.
+	class ScriptWatchdog
+	{
+	public:
+		explicit ScriptWatchdog(sol::state_view lua, int checkInterval = 1000)
+			: L(lua.lua_state()), checkInterval(std::max(checkInterval, 1)) {}
+		ScriptWatchdog(const ScriptWatchdog&) = delete;
+		ScriptWatchdog& operator=(const ScriptWatchdog&) = delete;
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		void SetDefaultBudget(const ScriptBudget& budget)										{ defaultBudget = budget; }
+		const ScriptBudget& GetDefaultBudget() const											{ return defaultBudget; }
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt3(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::SliderInt3(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+		template <typename... Args>
+		ScriptResult Run(const sol::protected_function& function, Args&&... args)				{ return RunWithBudget(function, defaultBudget, std::forward<Args>(args)...); }
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		template <typename... Args>
+		ScriptResult RunWithBudget(const sol::protected_function& function, const ScriptBudget& budget, Args&&... args)
+		{
+			const std::size_t depth{ detail::Stacks().size() };
+			const ActiveRun outer{ Active() };
+			Active() = { this, budget, std::chrono::steady_clock::now(), 0, false, {} };
+			Active().chain.Install(L, Hook, checkInterval);
+			const bool wrappedResume{ WrapResume(L) };
+
+			ScriptResult result;
+			{
+				const sol::protected_function_result call{ function(std::forward<Args>(args)...) };
+				if (!call.valid())
+				{
+					const sol::error error{ call.get<sol::error>() };
+					result.status = Active().aborted ? ScriptStatus::OverBudget : ScriptStatus::Error;
+					result.error = error.what();
+				}
+			}
+
+			if (wrappedResume) UnwrapResume(L);
+			// A hook installed during the run (the profiler started by the script) stays. The watchdog's Hook it chains to
+			// does nothing once the run is over.
+			if (lua_gethook(L) == Hook) Active().chain.Restore(L);
+			result.instructions = Active().instructions;
+			result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Active().start).count();
+			Active() = outer;
+			if (result.status != ScriptStatus::Ok) result.unwound = detail::UnwindStacks(depth);
+			return result;
+		}
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max);
+	private:
+		struct ActiveRun
+		{
+			const ScriptWatchdog*					watchdog;
+			ScriptBudget							budget;
+			std::chrono::steady_clock::time_point	start;
+			std::uint64_t							instructions;
+			bool									aborted;
+			detail::ChainedHook						chain;	// hook installed before the run, still called
+		};
+		static ActiveRun& Active()																{ static thread_local ActiveRun run{}; return run; }
+
+		static void Hook(lua_State* L, lua_Debug* ar)
+		{
+			ActiveRun& run{ Active() };
+			if (!run.watchdog || !run.chain.Dispatch(L, ar, run.watchdog->checkInterval)) return;
+
+			run.instructions += static_cast<std::uint64_t>(run.watchdog->checkInterval);
+			const bool overInstructions{ run.budget.instructions > 0 && run.instructions > run.budget.instructions };
+			const bool overTime{ run.budget.milliseconds > 0.0 &&
+				std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - run.start).count() > run.budget.milliseconds };
+			if (!overInstructions && !overTime) return;
+
+			// Raised again at every check, so a script catching it with pcall cannot keep running for long
+			run.aborted = true;
+			luaL_error(L, "script aborted: over its %s budget", overInstructions ? "instruction" : "time");
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Only coroutines created during the run inherit the count hook. For the others, coroutine.resume is replaced while the
+		// run lasts by one that hooks the resumed thread. Functions made by coroutine.wrap before the run are not covered.
+		static bool WrapResume(lua_State* L)
+		{
+			lua_getglobal(L, "coroutine");
+			if (!lua_istable(L, -1))
+			{
+				lua_pop(L, 1);
+				return false;
+			}
+			lua_getfield(L, -1, "resume");
+			lua_pushcclosure(L, Resume, 1);
+			lua_setfield(L, -2, "resume");
+			lua_pop(L, 1);
+			return true;
+		}
+		static void UnwrapResume(lua_State* L)
+		{
+			lua_getglobal(L, "coroutine");
+			if (lua_istable(L, -1))
+			{
+				lua_getfield(L, -1, "resume");
+				if (lua_tocfunction(L, -1) == Resume && lua_getupvalue(L, -1, 1)) lua_setfield(L, -3, "resume");
+				lua_pop(L, 1);
+			}
+			lua_pop(L, 1);
+		}
+		// Upvalue 1 is the original coroutine.resume
+		static int Resume(lua_State* L)
+		{
+			const ActiveRun& run{ Active() };
+			lua_State* thread{ lua_tothread(L, 1) };
+			const bool hook{ thread && run.watchdog && lua_gethook(thread) != Hook };
+			const lua_Hook previousHook{ thread ? lua_gethook(thread) : nullptr };
+			const int previousMask{ thread ? lua_gethookmask(thread) : 0 };
+			const int previousCount{ thread ? lua_gethookcount(thread) : 0 };
+			if (hook) lua_sethook(thread, Hook, run.chain.installedMask, run.chain.step);
+
+			lua_pushvalue(L, lua_upvalueindex(1));
+			lua_insert(L, 1);
+			const int status{ lua_pcall(L, lua_gettop(L) - 1, LUA_MULTRET, 0) };
+			if (hook) lua_sethook(thread, previousHook, previousMask, previousCount);
+			if (status != 0) return lua_error(L);
+			return lua_gettop(L);
+		}
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format)
+		lua_State*		L;
+		int				checkInterval;
+		ScriptBudget	defaultBudget;
+	};
+#endif
+#pragma endregion Script Watchdog
+
+#pragma region Parallel Panels
+#ifdef SOL_IMGUI_ENABLE_PARALLEL	// Define SOL_IMGUI_ENABLE_PARALLEL to build independent Lua panels on worker threads, each into its own ImGuiContext
+	// Building panels concurrently needs GImGui to be thread_local. In imconfig.h:
+	//     struct ImGuiContext; extern thread_local ImGuiContext* MyImGuiTLS; #define GImGui MyImGuiTLS
+	// and "thread_local ImGuiContext* MyImGuiTLS;" in one source file. Without it the panels are built one after the other.
+	class ParallelPanels
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max, format.c_str());
+	public:
+		// Construct on the main thread once its ImGuiContext exists. The main thread builds panels too, next to workerCount threads.
+		explicit ParallelPanels(unsigned int workerCount = std::max(std::thread::hardware_concurrency(), 1u) - 1)
+		{
+			bool sharedContext{};
+			std::thread([&sharedContext] { sharedContext = ImGui::GetCurrentContext() != nullptr; }).join();
+			if (sharedContext) return;
+			for (unsigned int i = 0; i < workerCount; i++) workers.emplace_back([this] { WorkerLoop(); });
+		}
+		~ParallelPanels()
+		{
+			{
+				const std::lock_guard<std::mutex> lock{ mutex };
+				stopping = true;
+			}
+			wake.notify_all();
+			for (auto& worker : workers) worker.join();
+		}
+		ParallelPanels(const ParallelPanels&) = delete;
+		ParallelPanels& operator=(const ParallelPanels&) = delete;
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Creates a panel with its own Lua state and ImGuiContext, sharing the main context's style and font atlas.
+		// Call sol_ImGui::Init on the returned state and load the panel's script. Build calls its global frameFunction every frame.
+		// The atlas must not be modified (fonts added or rebuilt) while Build runs.
+		sol::state& AddPanel(const std::string& frameFunction = "OnFrame")
+		{
+			ImGuiContext* main{ ImGui::GetCurrentContext() };
+			const ImGuiStyle style{ ImGui::GetStyle() };
+			auto panel{ std::make_unique<Panel>() };
+			panel->frameFunction = frameFunction;
+			panel->context = ImGui::CreateContext(ImGui::GetIO().Fonts);
+
+			ImGui::SetCurrentContext(panel->context);
+			ImGui::GetStyle() = style;
+			ImGuiIO& io{ ImGui::GetIO() };
+			io.IniFilename = nullptr;	// panels are rebuilt from their scripts and would race on the same files
+			io.LogFilename = nullptr;
+		#ifndef IMGUI_NO_DOCKING
+			io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;	// everything is merged into the main viewport
+		#endif
+			ImGui::SetCurrentContext(main);
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<int>>, bool> SliderInt4(const std::string& label, const sol::table& v, int v_min, int v_max, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::SliderInt4(label.c_str(), value, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags);
+			panels.push_back(std::move(panel));
+			return panels.back()->lua;
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		std::size_t GetPanelCount() const														{ return panels.size(); }
+		bool IsParallel() const																	{ return !workers.empty(); }
+		// The error raised by the panel's frame function during the last Build, empty when it ran
+		const std::string& GetPanelError(std::size_t index) const								{ return panels[index]->error; }
+	#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+		// The panel's scope timings, as GetScopeTimings() reports them inside its frame function. Call between two Builds.
+		std::vector<ScopeTiming> GetPanelScopeTimings(std::size_t index)
+		{
+			SwapPanelState(*panels[index]);
+			std::vector<ScopeTiming> timings{ GetScopeTimings() };
+			SwapPanelState(*panels[index]);
+			return timings;
+		}
+	#endif
+	#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+		// The panel's draw costs of its last frame. Call between two Builds.
+		const DrawCostFrameStats& GetPanelDrawCostStats(std::size_t index) const				{ return panels[index]->drawCosts.lastFrame; }
+	#endif
 
-		return std::make_tuple(int4, used);
-	}
-	inline void SliderScalar()																																							{ /* TODO: SliderScalar(...) ==> UNSUPPORTED */ }
-	inline void SliderScalarN()																																							{ /* TODO: SliderScalarN(...) ==> UNSUPPORTED */ }
-	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max)													{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max, const std::string& format)						{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<float, bool> VSliderFloat(const std::string& label, float sizeX, float sizeY, float v, float v_min, float v_max, const std::string& format, int flags)			{ bool used = ImGui::VSliderFloat(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max)															{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max, const std::string& format)									{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str()); return std::make_tuple(v, used); }
-	inline std::tuple<int, bool> VSliderInt(const std::string& label, float sizeX, float sizeY, int v, int v_min, int v_max, const std::string& format, int flags)						{ bool used = ImGui::VSliderInt(label.c_str(), { sizeX, sizeY }, &v, v_min, v_max, format.c_str(), (ImGuiSliderFlags)flags); return std::make_tuple(v, used); }
-	inline void VSliderScalar()																																							{ /* TODO: VSliderScalar(...) ==> UNSUPPORTED */ }
+		// Call on the main thread after ImGui::NewFrame(), once the previous frame has been rendered.
+		// Forwards the main context's input to every panel and returns when all of them are built.
+		void Build()
+		{
+			CaptureInput();
+			atlasLocked = ImGui::GetIO().Fonts->Locked;
+		#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+			for (auto& panel : panels)
+			{
+				panel->drawCosts.defaultBudget = detail::DrawCosts().defaultBudget;
+				panel->drawCosts.budgets = detail::DrawCosts().budgets;
+			}
+		#endif
+			if (workers.empty())
+			{
+				for (auto& panel : panels) BuildPanel(*panel);
+				return;
+			}
+
+			{
+				const std::lock_guard<std::mutex> lock{ mutex };
+				next = 0;
+				remaining = panels.size();
+				generation++;
+			}
+			wake.notify_all();
+			BuildPanels();
+
+			std::unique_lock<std::mutex> lock{ mutex };
+			done.wait(lock, [this] { return remaining == 0; });
+		}
 
-	// Widgets: Input with Keyboard
-	inline std::tuple<std::string, bool> InputText(const std::string& label, std::string text)																							{ bool selected = ImGui::InputText(label.c_str(), &text); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputText(const std::string& label, std::string text, int flags)																				{ bool selected = ImGui::InputText(label.c_str(), &text, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text)																					{ bool selected = ImGui::InputTextMultiline(label.c_str(), &text); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, float sizeX, float sizeY)														{ bool selected = ImGui::InputTextMultiline(label.c_str(), &text, { sizeX, sizeY }); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextMultiline(const std::string& label, std::string text, float sizeX, float sizeY, int flags)											{ bool selected = ImGui::InputTextMultiline(label.c_str(), &text, { sizeX, sizeY }, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextWithHint(const std::string& label, const std::string& hint, std::string text)															{ bool selected = ImGui::InputTextWithHint(label.c_str(), hint.c_str(), &text); return std::make_tuple(text, selected); }
-	inline std::tuple<std::string, bool> InputTextWithHint(const std::string& label, const std::string& hint, std::string text, int flags)												{ bool selected = ImGui::InputTextWithHint(label.c_str(), hint.c_str(), &text, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(text, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v)																										{ bool selected = ImGui::InputFloat(label.c_str(), &v); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step)																							{ bool selected = ImGui::InputFloat(label.c_str(), &v, step); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast)																			{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast, const std::string& format)												{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast, format.c_str()); return std::make_tuple(v, selected); }
-	inline std::tuple<float, bool> InputFloat(const std::string& label, float v, float step, float step_fast, const std::string& format, int flags)										{ bool selected = ImGui::InputFloat(label.c_str(), &v, step, step_fast, format.c_str(), static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::InputFloat2(label.c_str(), value);
+		// Call after ImGui::Render() on the main draw data, such as ImGui::GetDrawData(). The panels' draw lists are
+		// appended in the order the panels were added, and stay owned by the panels until the next Build.
+		void Merge(ImDrawData* drawData) const
+		{
+			for (const auto& panel : panels)
+			{
+				if (!panel->drawData || !panel->drawData->Valid) continue;
+				for (ImDrawList* drawList : panel->drawData->CmdLists) drawData->AddDrawList(drawList);
+			}
+		}
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+	private:
+		struct Panel
+		{
+			~Panel()																			{ if (context) ImGui::DestroyContext(context); }
+
+			sol::state				lua;
+			ImGuiContext*			context{};
+			std::string				frameFunction;
+			std::string				error;
+			std::vector<ImGuiKey>	keysDown;	// as of the panel's previous frame
+			ImDrawData*				drawData{};
+
+			// The panel's own per-thread hook state, swapped in while it is built
+		#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+			detail::TimingState			timings;
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+			detail::BindingStatsState	bindingCounters;
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+			detail::DrawCostState		drawCosts;
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+			detail::WindowCacheState	windowCaches;
+		#endif
+		};
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v, const std::string& format)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::InputFloat2(label.c_str(), value, format.c_str());
+		// The main context's input for this frame, read on the main thread
+		struct Input
+		{
+			float					deltaTime{};
+			ImVec2					displaySize;
+			ImVec2					framebufferScale;
+			ImGuiBackendFlags		backendFlags{};
+			ImVec2					mousePos;
+			bool					mouseDown[5]{};
+			float					wheel{};
+			float					wheelH{};
+			std::vector<ImGuiKey>	keys;
+			std::vector<ImWchar>	characters;
+		};
+
+		void CaptureInput()
+		{
+			const ImGuiIO& io{ ImGui::GetIO() };
+			input.deltaTime = io.DeltaTime;
+			input.displaySize = io.DisplaySize;
+			input.framebufferScale = io.DisplayFramebufferScale;
+			input.backendFlags = io.BackendFlags;
+			input.mousePos = io.MousePos;
+			for (int button = 0; button < 5; button++) input.mouseDown[button] = io.MouseDown[button];
+			input.wheel = io.MouseWheel;
+			input.wheelH = io.MouseWheelH;
+			input.keys.clear();
+			for (int key = ImGuiKey_NamedKey_BEGIN; key < ImGuiKey_NamedKey_END; key++)
+				if (ImGui::IsKeyDown(static_cast<ImGuiKey>(key))) input.keys.push_back(static_cast<ImGuiKey>(key));
+			input.characters.assign(io.InputQueueCharacters.begin(), io.InputQueueCharacters.end());
+		}
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+		void ApplyInput(Panel& panel) const
+		{
+			ImGuiIO& io{ ImGui::GetIO() };
+			io.DeltaTime = input.deltaTime > 0.0f ? input.deltaTime : 1.0f / 60.0f;
+			io.DisplaySize = input.displaySize;
+			io.DisplayFramebufferScale = input.framebufferScale;
+			io.BackendFlags = input.backendFlags;
+			io.AddMousePosEvent(input.mousePos.x, input.mousePos.y);
+			for (int button = 0; button < 5; button++) io.AddMouseButtonEvent(button, input.mouseDown[button]);
+			if (input.wheel != 0.0f || input.wheelH != 0.0f) io.AddMouseWheelEvent(input.wheelH, input.wheel);
+			for (const auto key : panel.keysDown)
+				if (std::find(input.keys.begin(), input.keys.end(), key) == input.keys.end()) io.AddKeyEvent(key, false);
+			for (const auto key : input.keys) io.AddKeyEvent(key, true);
+			panel.keysDown = input.keys;
+			for (const auto character : input.characters) io.AddInputCharacter(character);
+		}
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat2(const std::string& label, const sol::table& v, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[2] = { float(v1), float(v2) };
-		bool used = ImGui::InputFloat2(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+		// Every panel context shares the main font atlas, whose Locked flag NewFrame and EndFrame write. Those calls are
+		// serialized, and the flag is put back to its value in the main frame, which is still in progress.
+		static std::mutex& AtlasMutex()															{ static std::mutex mutex; return mutex; }
+
+		// Exchanges the thread's statistics and window caches with the panel's own
+		static void SwapPanelState([[maybe_unused]] Panel& panel)
+		{
+		#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+			std::swap(panel.timings, detail::Timings());
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+			std::swap(panel.bindingCounters, detail::BindingCounters());
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+			std::swap(panel.drawCosts, detail::DrawCosts());
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+			std::swap(panel.windowCaches, detail::WindowCaches());
+		#endif
+		}
+
+		// Runs on whichever thread picks the panel up. The per-thread wrapper stacks are set aside for the panel and
+		// restored afterwards, since the main thread may be in the middle of its own scripts. The panel's statistics and
+		// window caches are swapped in the same way and rolled here, as sol_ImGui::NewFrame does for the main thread.
+		void BuildPanel(Panel& panel)
+		{
+			ImGuiContext* previous{ ImGui::GetCurrentContext() };
+			ImGui::SetCurrentContext(panel.context);
+			ApplyInput(panel);
+			{
+				const std::lock_guard<std::mutex> lock{ AtlasMutex() };
+				ImGui::NewFrame();
+			}
+		#ifdef SOL_IMGUI_TRACK_SCOPES
+			std::vector<const char*> windows;
+			windows.swap(detail::Scopes().windows);
+		#endif
+		#ifdef SOL_IMGUI_TRACK_STACKS
+			std::vector<detail::StackEntry> stacks;
+			stacks.swap(detail::Stacks());
+		#endif
+			SwapPanelState(panel);
+		#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+			detail::RollScopeTimings();
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+			detail::RollBindingStats();
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+			detail::RollDrawCosts();
+		#endif
+		#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+			detail::RollWindowCaches();
+		#endif
 
-		sol::as_table_t float2 = sol::as_table(std::vector<float>{
-			value[0], value[1]
-		});
+			panel.error.clear();
+			sol::protected_function frame{ panel.lua[panel.frameFunction] };
+			if (!frame.valid()) panel.error = "no function " + panel.frameFunction;
+			else if (auto result{ frame() }; !result.valid())
+			{
+				panel.error = result.get<sol::error>().what();
+			#ifdef SOL_IMGUI_ENABLE_WATCHDOG
+				detail::UnwindStacks(0);
+			#endif
+			}
 
-		return std::make_tuple(float2, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::InputFloat3(label.c_str(), value);
+		#ifdef SOL_IMGUI_TRACK_SCOPES
+			windows.swap(detail::Scopes().windows);
+		#endif
+		#ifdef SOL_IMGUI_TRACK_STACKS
+			stacks.swap(detail::Stacks());
+		#endif
+			SwapPanelState(panel);
+			{
+				const std::lock_guard<std::mutex> lock{ AtlasMutex() };
+				ImGui::EndFrame();
+				ImGui::GetIO().Fonts->Locked = atlasLocked;
+			}
+			ImGui::Render();
+			panel.drawData = ImGui::GetDrawData();
+			ImGui::SetCurrentContext(previous);
+		}
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+		void BuildPanels()
+		{
+			for (std::size_t index; (index = next.fetch_add(1)) < panels.size();)
+			{
+				BuildPanel(*panels[index]);
+				const std::lock_guard<std::mutex> lock{ mutex };
+				if (--remaining == 0) done.notify_one();
+			}
+		}
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v, const std::string& format)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::InputFloat3(label.c_str(), value, format.c_str());
+		void WorkerLoop()
+		{
+			std::uint64_t seen{};
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock{ mutex };
+					wake.wait(lock, [this, &seen] { return stopping || generation != seen; });
+					if (stopping) return;
+					seen = generation;
+				}
+				BuildPanels();
+			}
+		}
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+		std::vector<std::unique_ptr<Panel>>	panels;
+		Input								input;
+		std::vector<std::thread>			workers;
+		std::mutex							mutex;
+		std::condition_variable				wake;
+		std::condition_variable				done;
+		std::atomic<std::size_t>			next{};
+		std::size_t							remaining{};
+		std::uint64_t						generation{};
+		bool								stopping{};
+		bool								atlasLocked{};	// the shared atlas' Locked flag in the main frame
+	};
+#endif
+#pragma endregion Parallel Panels
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat3(const std::string& label, const sol::table& v, const std::string& format, int flags)
+#pragma region Draw Data Pipeline
+#ifdef SOL_IMGUI_ENABLE_PIPELINE	// Define SOL_IMGUI_ENABLE_PIPELINE to render the previous frame on another thread while Lua builds the next one
+	// Deep copy of an ImDrawData. The draw lists and their buffers are reused from one copy to the next, so copying
+	// a frame of the same size as the last one allocates nothing.
+	class DrawDataSnapshot
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[3] = { float(v1), float(v2), float(v3) };
-		bool used = ImGui::InputFloat3(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+	public:
+		DrawDataSnapshot() = default;
+		~DrawDataSnapshot()																		{ for (ImDrawList* drawList : drawLists) IM_DELETE(drawList); }
+		DrawDataSnapshot(const DrawDataSnapshot&) = delete;
+		DrawDataSnapshot& operator=(const DrawDataSnapshot&) = delete;
 
-		sol::as_table_t float3 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2]
-		});
+		void CopyFrom(const ImDrawData& source)
+		{
+			while (static_cast<int>(drawLists.size()) < source.CmdListsCount) drawLists.push_back(IM_NEW(ImDrawList)(nullptr));	// never drawn into, only rendered
+			drawData.Valid = source.Valid;
+			drawData.CmdListsCount = source.CmdListsCount;
+			drawData.TotalIdxCount = source.TotalIdxCount;
+			drawData.TotalVtxCount = source.TotalVtxCount;
+			drawData.DisplayPos = source.DisplayPos;
+			drawData.DisplaySize = source.DisplaySize;
+			drawData.FramebufferScale = source.FramebufferScale;
+			drawData.OwnerViewport = source.OwnerViewport;
+			drawData.CmdLists.resize(source.CmdListsCount);
+
+			textureIDs.clear();
+			for (int i = 0; i < source.CmdListsCount; i++)
+			{
+				const ImDrawList& from{ *source.CmdLists[i] };
+				ImDrawList& to{ *drawLists[i] };
+				CopyBuffer(to.CmdBuffer, from.CmdBuffer);
+				CopyBuffer(to.IdxBuffer, from.IdxBuffer);
+				CopyBuffer(to.VtxBuffer, from.VtxBuffer);
+				to.Flags = from.Flags;
+				drawData.CmdLists[i] = &to;
+				for (const ImDrawCmd& command : from.CmdBuffer)
+					if (std::find(textureIDs.begin(), textureIDs.end(), command.TextureId) == textureIDs.end()) textureIDs.push_back(command.TextureId);
+			}
+		}
 
-		return std::make_tuple(float3, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::InputFloat4(label.c_str(), value);
+		// Pass to the renderer backend. Null until the first copy of a valid frame.
+		ImDrawData* GetDrawData()																{ return drawData.Valid ? &drawData : nullptr; }
+		// Textures the snapshot draws with, to keep alive until it has been rendered
+		const std::vector<ImTextureID>& GetTextureIDs() const									{ return textureIDs; }
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+	private:
+		// Unlike ImVector's assignment, which frees and reallocates, keeps the capacity of the destination
+		template <typename T>
+		static void CopyBuffer(ImVector<T>& to, const ImVector<T>& from)
+		{
+			to.resize(from.Size);
+			if (from.Size > 0) std::memcpy(to.Data, from.Data, static_cast<std::size_t>(from.Size) * sizeof(T));
+		}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v, const std::string& format)
+		ImDrawData					drawData;
+		std::vector<ImDrawList*>	drawLists;
+		std::vector<ImTextureID>	textureIDs;
+	};
+
+	// Two snapshots handed between the thread running Lua and ImGui and the thread rendering. The UI thread copies each
+	// frame into the snapshot the render thread is not reading, so frame N+1 is built while frame N is rendered.
+	class DrawDataPipeline
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::InputFloat4(label.c_str(), value, format.c_str());
+	public:
+		// UI thread, after ImGui::Render(). Waits only when the render thread still holds the snapshot it would overwrite.
+		void Publish(const ImDrawData& drawData)
+		{
+			{
+				std::unique_lock<std::mutex> lock{ mutex };
+				released.wait(lock, [this] { return reading != write || stopping; });
+				if (stopping) return;
+			}
+			snapshots[write].CopyFrom(drawData);
+			{
+				const std::lock_guard<std::mutex> lock{ mutex };
+				latest = write;
+				published++;
+			}
+			ready.notify_one();
+			write ^= 1;
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Render thread. Waits for a frame newer than the last one acquired and holds its snapshot until Release().
+		// Returns null once Stop() has been called.
+		DrawDataSnapshot* Acquire()
+		{
+			std::unique_lock<std::mutex> lock{ mutex };
+			ready.wait(lock, [this] { return published != acquired || stopping; });
+			if (stopping) return nullptr;
+			reading = latest;
+			acquired = published;
+			rendered++;
+			return &snapshots[reading];
+		}
+		void Release()
+		{
+			{
+				const std::lock_guard<std::mutex> lock{ mutex };
+				reading = -1;
+			}
+			released.notify_one();
+		}
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<float>>, bool> InputFloat4(const std::string& label, const sol::table& v, const std::string& format, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float value[4] = { float(v1), float(v2), float(v3), float(v4) };
-		bool used = ImGui::InputFloat4(label.c_str(), value, format.c_str(), static_cast<ImGuiInputTextFlags>(flags));
+		// Wakes both threads, for shutdown
+		void Stop()
+		{
+			{
+				const std::lock_guard<std::mutex> lock{ mutex };
+				stopping = true;
+			}
+			ready.notify_all();
+			released.notify_all();
+		}
 
-		sol::as_table_t float4 = sol::as_table(std::vector<float>{
-			value[0], value[1], value[2], value[3]
-		});
+		// Frames published by the UI thread and acquired by the render thread. The render thread skips a frame when a
+		// newer one was published before it asked, so the difference shows which of the two stages is the slower one.
+		std::uint64_t GetPublishedFrames() const												{ const std::lock_guard<std::mutex> lock{ mutex }; return published; }
+		std::uint64_t GetRenderedFrames() const													{ const std::lock_guard<std::mutex> lock{ mutex }; return rendered; }
+
+	private:
+		DrawDataSnapshot			snapshots[2];
+		mutable std::mutex			mutex;
+		std::condition_variable		ready;
+		std::condition_variable		released;
+		int							write{};		// only touched by the UI thread
+		int							latest{ -1 };
+		int							reading{ -1 };
+		std::uint64_t				published{};
+		std::uint64_t				acquired{};		// value of published when the render thread last acquired
+		std::uint64_t				rendered{};
+		bool						stopping{};
+	};
+#endif
+#pragma endregion Draw Data Pipeline
 
-		return std::make_tuple(float4, used);
-	}
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v)																												{ bool selected = ImGui::InputInt(label.c_str(), &v); return std::make_tuple(v, selected); }
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step)																									{ bool selected = ImGui::InputInt(label.c_str(), &v, step); return std::make_tuple(v, selected); }
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step, int step_fast)																						{ bool selected = ImGui::InputInt(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
-	inline std::tuple<int, bool> InputInt(const std::string& label, int v, int step, int step_fast, int flags)																			{ bool selected = ImGui::InputInt(label.c_str(), &v, step, step_fast, static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const std::string& label, const sol::table& v)
+#pragma region Message Queue
+#ifdef SOL_IMGUI_ENABLE_MESSAGE_QUEUE	// Define SOL_IMGUI_ENABLE_MESSAGE_QUEUE to let any thread post data that Lua panels drain once per frame
+	// Lock-free bounded queue with any number of producer threads and one consumer, the thread running Lua.
+	// Producers never wait: Push returns false, and the message is counted as dropped, when the queue is full.
+	class MessageQueue
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::InputInt2(label.c_str(), value);
+	public:
+		static constexpr std::size_t MaxBytes{ SOL_IMGUI_MESSAGE_BYTES };	// longest string or blob a message holds
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+		// Capacity is rounded up to a power of two
+		explicit MessageQueue(std::size_t capacity = 4096)
+		{
+			std::size_t size{ 2 };
+			while (size < capacity) size <<= 1;
+			cells = std::make_unique<Cell[]>(size);
+			mask = size - 1;
+			for (std::size_t i = 0; i < size; i++) cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		MessageQueue(const MessageQueue&) = delete;
+		MessageQueue& operator=(const MessageQueue&) = delete;
+
+		// Any thread. Messages of one producer arrive in the order it pushed them.
+		bool Push(std::uint32_t channel, double number)											{ return Enqueue(channel, Type::Number, [number](Message& message) { message.number = number; }); }
+		bool Push(std::uint32_t channel, std::int64_t integer)									{ return Enqueue(channel, Type::Integer, [integer](Message& message) { message.integer = integer; }); }
+		bool Push(std::uint32_t channel, int integer)											{ return Push(channel, static_cast<std::int64_t>(integer)); }
+		bool Push(std::uint32_t channel, const char* text)										{ return Push(channel, text, std::char_traits<char>::length(text)); }
+		bool Push(std::uint32_t channel, const std::string& text)								{ return Push(channel, text.data(), text.size()); }
+		// Strings and blobs both arrive in Lua as strings
+		bool Push(std::uint32_t channel, const void* data, std::size_t size)
+		{
+			if (size > MaxBytes)
+			{
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+			return Enqueue(channel, Type::Bytes, [data, size](Message& message)
+			{
+				message.size = static_cast<std::uint16_t>(size);
+				if (size > 0) std::memcpy(message.bytes, data, size);
+			});
+		}
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt2(const std::string& label, const sol::table& v, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[2] = { int(v1), int(v2) };
-		bool used = ImGui::InputInt2(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+		std::uint64_t GetDroppedCount() const													{ return dropped.load(std::memory_order_relaxed); }
 
-		sol::as_table_t int2 = sol::as_table(std::vector<int>{
-			value[0], value[1]
-		});
+		// Consumer thread only. Calls callback(channel, value) for up to limit messages, all the queue holds by default.
+		// Returns the number of messages drained.
+		int Drain(const sol::protected_function& callback, sol::optional<int> limit)
+		{
+			int drained{};
+			for (Message message; drained < limit.value_or(static_cast<int>(mask + 1)) && Dequeue(message); drained++)
+			{
+				sol::protected_function_result result{ [&] {
+					switch (message.type)
+					{
+					case Type::Number:	return callback(message.channel, message.number);
+					case Type::Integer:	return callback(message.channel, message.integer);
+					default:			return callback(message.channel, std::string(message.bytes, message.size));
+					}
+				}() };
+				if (!result.valid()) throw result.get<sol::error>();
+			}
+			return drained;
+		}
+		// Appends each value to the array tables[channel], creating it when missing
+		int DrainInto(sol::table tables, sol::optional<int> limit)
+		{
+			int drained{};
+			for (Message message; drained < limit.value_or(static_cast<int>(mask + 1)) && Dequeue(message); drained++)
+			{
+				sol::optional<sol::table> existing{ tables.get<sol::optional<sol::table>>(message.channel) };
+				sol::table values{ existing ? *existing : tables.create_with() };
+				if (!existing) tables.set(message.channel, values);
+				const auto next{ values.size() + 1 };
+				switch (message.type)
+				{
+				case Type::Number:	values.raw_set(next, message.number); break;
+				case Type::Integer:	values.raw_set(next, message.integer); break;
+				default:			values.raw_set(next, std::string(message.bytes, message.size)); break;
+				}
+			}
+			return drained;
+		}
 
-		return std::make_tuple(int2, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const std::string& label, const sol::table& v)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::InputInt3(label.c_str(), value);
+	private:
+		enum class Type : unsigned char { Number, Integer, Bytes };
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		struct Message
+		{
+			std::uint32_t	channel{};
+			Type			type{};
+			std::uint16_t	size{};
+			union
+			{
+				double			number;
+				std::int64_t	integer;
+				char			bytes[MaxBytes];
+			};
+		};
+
+		struct Cell
+		{
+			std::atomic<std::size_t>	sequence;	// equal to the enqueue position when free, to position + 1 once written
+			Message						message;
+		};
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt3(const std::string& label, const sol::table& v, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[3] = { int(v1), int(v2), int(v3) };
-		bool used = ImGui::InputInt3(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+		template <typename Write>
+		bool Enqueue(std::uint32_t channel, Type type, Write&& write)
+		{
+			std::size_t position{ enqueuePosition.load(std::memory_order_relaxed) };
+			Cell* cell;
+			for (;;)
+			{
+				cell = &cells[position & mask];
+				const std::size_t sequence{ cell->sequence.load(std::memory_order_acquire) };
+				const auto difference{ static_cast<std::ptrdiff_t>(sequence - position) };
+				if (difference == 0)
+				{
+					if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+				}
+				else if (difference < 0)
+				{
+					dropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				else position = enqueuePosition.load(std::memory_order_relaxed);
+			}
+			cell->message.channel = channel;
+			cell->message.type = type;
+			write(cell->message);
+			cell->sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
 
-		sol::as_table_t int3 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2]
-		});
+		bool Dequeue(Message& message)
+		{
+			Cell& cell{ cells[dequeuePosition & mask] };
+			if (cell.sequence.load(std::memory_order_acquire) != dequeuePosition + 1) return false;
+			message.channel = cell.message.channel;
+			message.type = cell.message.type;
+			message.size = cell.message.size;
+			if (message.type == Type::Bytes) std::memcpy(message.bytes, cell.message.bytes, message.size);
+			else message.integer = cell.message.integer;
+			cell.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+			dequeuePosition++;
+			return true;
+		}
 
-		return std::make_tuple(int3, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const std::string& label, const sol::table& v)
+		std::unique_ptr<Cell[]>						cells;
+		std::size_t									mask{};
+		alignas(64) std::atomic<std::size_t>		enqueuePosition{};
+		alignas(64) std::size_t						dequeuePosition{};
+		alignas(64) std::atomic<std::uint64_t>		dropped{};
+	};
+#endif
+#pragma endregion Message Queue
+
+#pragma region Retained Widgets
+#ifdef SOL_IMGUI_ENABLE_RETAINED	// Define SOL_IMGUI_ENABLE_RETAINED for windows Lua describes once and C++ submits every frame
+	// A window whose widgets Lua lays out once. Value widgets edit a field of a Lua table or a native variable, and the
+	// walk submitting them every frame runs in C++: Lua only runs when the user changes a value or presses a button.
+	// Lua shares ownership of the windows it creates, so a destroyed window raises an error instead of being freed under it.
+	class RetainedWindow : public std::enable_shared_from_this<RetainedWindow>
 	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::InputInt4(label.c_str(), value);
+	public:
+		RetainedWindow(std::string name, int flags) : name(std::move(name)), flags(flags) {}
+		RetainedWindow(const RetainedWindow&) = delete;
+		RetainedWindow& operator=(const RetainedWindow&) = delete;
+
+		// Builders, returning a handle to the new widget. onChange(value) runs after the window's End.
+		int Text(const std::string& text)																					{ return Add(Widget::Text, text).handle; }
+		int Separator()																										{ return Add(Widget::Separator, {}).handle; }
+		int SameLine()																										{ return Add(Widget::SameLine, {}).handle; }
+		int Button(const std::string& label, const sol::protected_function& onClick)
+		{
+			Node& node{ Add(Widget::Button, label) };
+			node.callback = onClick;
+			return node.handle;
+		}
+		int Checkbox(const std::string& label, sol::table table, sol::object key, sol::optional<sol::protected_function> onChange)
+		{
+			return Bind(Add(Widget::Checkbox, label), table, key, onChange);
+		}
+		int SliderFloat(const std::string& label, sol::table table, sol::object key, float min, float max, sol::optional<sol::protected_function> onChange)
+		{
+			return Bind(AddRange(Widget::SliderFloat, label, 0.0f, min, max), table, key, onChange);
+		}
+		int SliderInt(const std::string& label, sol::table table, sol::object key, int min, int max, sol::optional<sol::protected_function> onChange)
+		{
+			return Bind(AddRange(Widget::SliderInt, label, 0.0f, static_cast<float>(min), static_cast<float>(max)), table, key, onChange);
+		}
+		int DragFloat(const std::string& label, sol::table table, sol::object key, float speed, float min, float max, sol::optional<sol::protected_function> onChange)
+		{
+			return Bind(AddRange(Widget::DragFloat, label, speed, min, max), table, key, onChange);
+		}
+		int InputText(const std::string& label, sol::table table, sol::object key, sol::optional<sol::protected_function> onChange)
+		{
+			return Bind(Add(Widget::InputText, label), table, key, onChange);
+		}
+		// Widgets added between TreeNode and TreePop are only walked while the node is open
+		int TreeNode(const std::string& label)
+		{
+			Node& node{ Add(Widget::TreeNode, label) };
+			openTrees.push_back(nodes.size() - 1);
+			return node.handle;
+		}
+		int TreePop()
+		{
+			if (openTrees.empty()) throw sol::error("RetainedWindow:TreePop called without a matching TreeNode");
+			Node& node{ Add(Widget::TreePop, {}) };
+			nodes[openTrees.back()].treePop = nodes.size() - 1;
+			openTrees.pop_back();
+			return node.handle;
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+		// C++ builders editing native variables in place, which must outlive the window
+		int Checkbox(const std::string& label, bool* value)																{ return BindNative(Add(Widget::Checkbox, label), value); }
+		int SliderFloat(const std::string& label, float* value, float min, float max)									{ return BindNative(AddRange(Widget::SliderFloat, label, 0.0f, min, max), value); }
+		int SliderInt(const std::string& label, int* value, int min, int max)											{ return BindNative(AddRange(Widget::SliderInt, label, 0.0f, static_cast<float>(min), static_cast<float>(max)), value); }
+		int DragFloat(const std::string& label, float* value, float speed, float min, float max)						{ return BindNative(AddRange(Widget::DragFloat, label, speed, min, max), value); }
+		int InputText(const std::string& label, std::string* value)														{ return BindNative(Add(Widget::InputText, label), value); }
+
+		// Changes the text of a Text widget, or the label of any other widget
+		void SetLabel(int handle, const std::string& label)																{ At(handle).label = label; }
+		// Widgets keep their own copy of the table fields they edit: call Refresh after Lua changed those fields
+		void Refresh()																										{ CheckAlive(); for (Node& node : nodes) Load(node); }
+		void Clear()																										{ CheckAlive(); nodes.clear(); openTrees.clear(); }
+		void SetVisible(bool show)																							{ CheckAlive(); visible = show; }
+		bool IsVisible() const																								{ CheckAlive(); return visible; }
+		bool IsDestroyed() const																							{ return destroyed; }
+
+		void Render()
+		{
+			if (destroyed || !visible) return;
+			if (!openTrees.empty()) throw sol::error("RetainedWindow '" + name + "' has a TreeNode without a matching TreePop");
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple <sol::as_table_t<std::vector<int>>, bool> InputInt4(const std::string& label, const sol::table& v, int flags)
-	{
-		const lua_Number	v1{ v[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v2{ v[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v3{ v[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							v4{ v[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		int value[4] = { int(v1), int(v2), int(v3), int(v4) };
-		bool used = ImGui::InputInt4(label.c_str(), value, static_cast<ImGuiInputTextFlags>(flags));
+			fired.clear();
+			if (ImGui::Begin(name.c_str(), nullptr, flags)) Submit();
+			ImGui::End();
+			for (const int handle : fired)
+				if (Node* node{ Find(handle) }) Dispatch(*node);	// unless a callback removed it
+		}
 
-		sol::as_table_t int4 = sol::as_table(std::vector<int>{
-			value[0], value[1], value[2], value[3]
-		});
+	private:
+		friend class RetainedUI;
 
-		return std::make_tuple(int4, used);
-	}
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v)																										{ bool selected = ImGui::InputDouble(label.c_str(), &v); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step)																						{ bool selected = ImGui::InputDouble(label.c_str(), &v, step); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast)																		{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast, const std::string& format)											{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast, format.c_str()); return std::make_tuple(v, selected); }
-	inline std::tuple<double, bool> InputDouble(const std::string& label, double v, double step, double step_fast, const std::string& format, int flags)								{ bool selected = ImGui::InputDouble(label.c_str(), &v, step, step_fast, format.c_str(), static_cast<ImGuiInputTextFlags>(flags)); return std::make_tuple(v, selected); }
-	inline void InputScalar()																																							{ /* TODO: InputScalar(...) ==> UNSUPPORTED */ }
-	inline void InputScalarN()																																							{ /* TODO: InputScalarN(...) ==> UNSUPPORTED */ }
+		enum class Widget { Text, Separator, SameLine, Button, Checkbox, SliderFloat, SliderInt, DragFloat, InputText, TreeNode, TreePop };
 
-	// Widgets: Color Editor / Picker
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const std::string& label, const sol::table& col)
-	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-			b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorEdit3(label.c_str(), color);
+		struct Node
+		{
+			Widget						widget;
+			int							handle;
+			std::string					label;
+			float						speed{}, min{}, max{};
+			void*						native{};		// edited variable, when bound from C++
+			sol::table					table;			// else the table and key of the edited field
+			sol::object					key;
+			bool						boolean{};		// copies of the edited field
+			float						number{};
+			int							integer{};
+			std::string					text;
+			sol::protected_function		callback;
+			std::size_t					treePop{};		// TreeNode: index of its TreePop, where a closed node resumes
+		};
+
+		void CheckAlive() const
+		{
+			if (destroyed) throw sol::error("RetainedWindow '" + name + "' was destroyed");
+		}
 
-		sol::as_table_t rgb = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2]
-		});
+		Node& Add(Widget widget, std::string label)
+		{
+			CheckAlive();
+			Node& node{ nodes.emplace_back() };
+			node.widget = widget;
+			node.handle = nextHandle++;
+			node.label = std::move(label);
+			return node;
+		}
+		Node& AddRange(Widget widget, std::string label, float speed, float min, float max)
+		{
+			Node& node{ Add(widget, std::move(label)) };
+			node.speed = speed;
+			node.min = min;
+			node.max = max;
+			return node;
+		}
+		int Bind(Node& node, sol::table table, sol::object key, sol::optional<sol::protected_function> onChange)
+		{
+			node.table = std::move(table);
+			node.key = std::move(key);
+			if (onChange) node.callback = *onChange;
+			Load(node);
+			return node.handle;
+		}
+		int BindNative(Node& node, void* value)
+		{
+			node.native = value;
+			return node.handle;
+		}
+		Node* Find(int handle)
+		{
+			for (Node& node : nodes)
+				if (node.handle == handle) return &node;
+			return nullptr;
+		}
+		Node& At(int handle)
+		{
+			CheckAlive();
+			if (Node* node{ Find(handle) }) return *node;
+			throw sol::error("RetainedWindow has no widget " + std::to_string(handle));
+		}
 
-		return std::make_tuple(rgb, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit3(const std::string& label, const sol::table& col, int flags)
-	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorEdit3(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		void Load(Node& node)
+		{
+			if (!node.table.valid()) return;
+			switch (node.widget)
+			{
+			case Widget::Checkbox:		node.boolean = node.table.get_or<bool>(node.key, node.boolean); break;
+			case Widget::SliderInt:		node.integer = node.table.get_or<int>(node.key, node.integer); break;
+			case Widget::SliderFloat:
+			case Widget::DragFloat:		node.number = node.table.get_or<float>(node.key, node.number); break;
+			case Widget::InputText:		node.text = node.table.get_or<std::string>(node.key, node.text); break;
+			default:					break;
+			}
+		}
 
-		sol::as_table_t rgb = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2]
-		});
+		template <typename T>
+		static T* Value(Node& node, T& copy)																				{ return node.native ? static_cast<T*>(node.native) : &copy; }
+
+		void Submit()
+		{
+			for (std::size_t i = 0; i < nodes.size(); i++)
+			{
+				Node& node{ nodes[i] };
+				const char* label{ node.label.c_str() };
+				bool changed{};
+				switch (node.widget)
+				{
+				case Widget::Text:			ImGui::TextUnformatted(label); break;
+				case Widget::Separator:		ImGui::Separator(); break;
+				case Widget::SameLine:		ImGui::SameLine(); break;
+				case Widget::Button:		changed = ImGui::Button(label); break;
+				case Widget::Checkbox:		changed = ImGui::Checkbox(label, Value(node, node.boolean)); break;
+				case Widget::SliderFloat:	changed = ImGui::SliderFloat(label, Value(node, node.number), node.min, node.max); break;
+				case Widget::SliderInt:		changed = ImGui::SliderInt(label, Value(node, node.integer), static_cast<int>(node.min), static_cast<int>(node.max)); break;
+				case Widget::DragFloat:		changed = ImGui::DragFloat(label, Value(node, node.number), node.speed, node.min, node.max); break;
+				case Widget::InputText:		changed = ImGui::InputText(label, Value(node, node.text)); break;
+				case Widget::TreeNode:		if (!ImGui::TreeNode(label)) i = node.treePop; break;	// skips the children and the TreePop
+				case Widget::TreePop:		ImGui::TreePop(); break;
+				}
+				if (changed) fired.push_back(node.handle);
+			}
+		}
 
-		return std::make_tuple(rgb, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const std::string& label, const sol::table& col)
+		// Works on copies: the table write and the callback may add widgets or Clear the window, moving or destroying the node
+		void Dispatch(Node& node)
+		{
+			const sol::protected_function callback{ node.callback };
+			sol::table table{ node.table };
+			const sol::object key{ node.key };
+			sol::protected_function_result result{ [&] {
+				switch (node.widget)
+				{
+				case Widget::Button:		return callback();
+				case Widget::Checkbox:		return Publish(callback, table, key, *Value(node, node.boolean));
+				case Widget::SliderInt:		return Publish(callback, table, key, *Value(node, node.integer));
+				case Widget::InputText:		return Publish(callback, table, key, *Value(node, node.text));
+				default:					return Publish(callback, table, key, *Value(node, node.number));
+				}
+			}() };
+			if (!result.valid()) throw result.get<sol::error>();
+		}
+		template <typename T>
+		static sol::protected_function_result Publish(const sol::protected_function& callback, sol::table& table, const sol::object& key, const T value)
+		{
+			if (table.valid()) table.set(key, value);
+			if (!callback.valid()) return {};
+			return callback(value);
+		}
+
+		std::string							name;
+		int									flags;
+		bool								visible{ true };
+		std::vector<Node>					nodes;
+		std::vector<std::size_t>			openTrees;
+		std::vector<int>					fired;			// handles of the widgets changed or pressed this frame, dispatched after End
+		int									nextHandle{ 1 };
+		bool								destroyed{};
+	};
+
+	// Owns the retained windows of a Lua state and renders them. Destroy it before the state.
+	class RetainedUI
 	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorEdit4(label.c_str(), color);
+	public:
+		static constexpr const char* RegistryKey = "sol_ImGui.RetainedUI";
 
-		sol::as_table_t rgba = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2], color[3]
-		});
+		explicit RetainedUI(sol::state_view lua)
+			: L(lua.lua_state())
+		{
+			lua_pushlightuserdata(L, this);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		~RetainedUI()
+		{
+			lua_pushnil(L);
+			lua_setfield(L, LUA_REGISTRYINDEX, RegistryKey);
+		}
+		RetainedUI(const RetainedUI&) = delete;
+		RetainedUI& operator=(const RetainedUI&) = delete;
 
-		return std::make_tuple(rgba, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorEdit4(const std::string& label, const sol::table& col, int flags)
-	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorEdit4(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		RetainedWindow& CreateWindow(const std::string& name, int flags = 0)
+		{
+			windows.push_back(std::make_shared<RetainedWindow>(name, flags));
+			return *windows.back();
+		}
+		// The window stops rendering at once and releases its widgets. It leaves the list once no Render is walking it,
+		// and is freed when Lua drops its last reference. Callbacks may destroy their own window.
+		void DestroyWindow(RetainedWindow& window)
+		{
+			if (window.destroyed) return;
+			window.destroyed = true;
+			window.nodes.clear();
+			window.openTrees.clear();
+			if (!rendering) RemoveDestroyed();
+		}
 
-		sol::as_table_t rgba = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2], color[3]
-		});
+		// Call once per frame, between NewFrame and Render. Runs no Lua unless a widget fired.
+		void Render()
+		{
+			rendering = true;
+			for (std::size_t i = 0; i < windows.size(); i++) windows[i]->Render();	// callbacks may create and destroy windows
+			rendering = false;
+			RemoveDestroyed();
+		}
 
-		return std::make_tuple(rgba, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const std::string& label, const sol::table& col)
-	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorPicker3(label.c_str(), color);
+		static RetainedUI* From(lua_State* L)
+		{
+			lua_getfield(L, LUA_REGISTRYINDEX, RegistryKey);
+			auto* retained{ static_cast<RetainedUI*>(lua_touserdata(L, -1)) };
+			lua_pop(L, 1);
+			return retained;
+		}
 
-		sol::as_table_t rgb = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2]
-		});
+	private:
+		void RemoveDestroyed()
+		{
+			windows.erase(std::remove_if(windows.begin(), windows.end(), [](const auto& window) { return window->destroyed; }), windows.end());
+		}
 
-		return std::make_tuple(rgb, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker3(const std::string& label, const sol::table& col, int flags)
+		lua_State*										L;
+		std::vector<std::shared_ptr<RetainedWindow>>	windows;
+		bool											rendering{};
+	};
+
+	namespace detail
 	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[3] = { float(r), float(g), float(b) };
-		bool used = ImGui::ColorPicker3(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		inline RetainedUI& AttachedRetainedUI(lua_State* L)
+		{
+			RetainedUI* retained{ RetainedUI::From(L) };
+			if (!retained) throw sol::error("no sol_ImGui::RetainedUI is attached to this state");
+			return *retained;
+		}
+	}
 
-		sol::as_table_t rgb = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2]
-		});
+	inline std::shared_ptr<RetainedWindow> CreateRetainedWindow(sol::this_state s, const std::string& name, sol::optional<int> flags)	{ return detail::AttachedRetainedUI(s).CreateWindow(name, flags.value_or(0)).shared_from_this(); }
+	inline void DestroyRetainedWindow(sol::this_state s, RetainedWindow* window)													{ if (window) detail::AttachedRetainedUI(s).DestroyWindow(*window); }
+#endif
+#pragma endregion Retained Widgets
 
-		return std::make_tuple(rgb, used);
+#pragma region Property Grid
+#ifdef SOL_IMGUI_ENABLE_PROPERTY_GRID	// Define SOL_IMGUI_ENABLE_PROPERTY_GRID to render whole inspectors in one binding call
+	namespace detail
+	{
+		// True when format holds at most one printf conversion, without length modifier or '*', and among conversions
+		inline bool FormatAccepts(const std::string& format, const char* conversions)
+		{
+			const auto IsDigit = [&format](std::size_t i) { return i < format.size() && format[i] >= '0' && format[i] <= '9'; };
+			int count{};
+			for (std::size_t i = 0; i < format.size(); i++)
+			{
+				if (format[i] != '%') continue;
+				if (++i < format.size() && format[i] == '%') continue;
+				while (i < format.size() && format[i] != '\0' && std::strchr("-+ #0", format[i])) i++;
+				while (IsDigit(i)) i++;
+				if (i < format.size() && format[i] == '.')
+					for (i++; IsDigit(i); i++) {}
+				if (i >= format.size() || format[i] == '\0' || !std::strchr(conversions, format[i]) || ++count > 1) return false;
+			}
+			return true;
+		}
 	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const std::string& label, const sol::table& col)
+
+	// Field descriptions checked once by ImGui.CreatePropertySpecs, so PropertyGrid can render them without validating
+	class PropertySpecs
 	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorPicker4(label.c_str(), color);
+	public:
+		enum class Type { Float, Int, Bool, String, Combo, Text };
 
-		sol::as_table_t rgba = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2], color[3]
-		});
+		struct Field
+		{
+			std::string					key;			// field of the values table
+			std::string					label;
+			Type						type{};
+			bool						slider{};		// Float and Int: SliderFloat/SliderInt instead of DragFloat/DragInt
+			float						speed{ 1.0f };
+			float						min{}, max{};
+			std::string					format;
+			std::vector<std::string>	items;			// Combo
+			std::vector<const char*>	itemPointers;
+		};
+
+		// Each spec is a table: { name = "speed", type = "float", min = 0, max = 10, speed = 0.1, format = "%.2f" }.
+		// type is "float", "int", "bool", "string", "combo" (with items = { ... }) or "text" (read-only), label defaults to name.
+		explicit PropertySpecs(const sol::table& specs)
+		{
+			static const std::pair<const char*, Type> types[]{ { "float", Type::Float }, { "int", Type::Int }, { "bool", Type::Bool }, { "string", Type::String }, { "combo", Type::Combo }, { "text", Type::Text } };
+
+			const std::size_t count{ specs.size() };
+			fields.reserve(count);
+			for (std::size_t i = 1; i <= count; i++)
+			{
+				const auto Fail = [i](const std::string& reason) { return sol::error("property spec " + std::to_string(i) + ": " + reason); };
+				const sol::optional<sol::table> spec{ specs.get<sol::optional<sol::table>>(i) };
+				if (!spec) throw Fail("expected a table");
+
+				Field field;
+				const sol::optional<std::string> name{ spec->get<sol::optional<std::string>>("name") };
+				if (!name) throw Fail("name must be a string");
+				field.key = *name;
+				field.label = spec->get_or<std::string>("label", *name);
+
+				const std::string type{ spec->get_or<std::string>("type", "float") };
+				const auto match{ std::find_if(std::begin(types), std::end(types), [&type](const auto& entry) { return type == entry.first; }) };
+				if (match == std::end(types)) throw Fail("unknown type '" + type + "'");
+				field.type = match->second;
+
+				field.slider = spec->get_or<std::string>("widget", "drag") == "slider";
+				field.speed = spec->get_or<float>("speed", field.type == Type::Int ? 1.0f : 0.1f);
+				field.min = spec->get_or<float>("min", 0.0f);
+				field.max = spec->get_or<float>("max", field.slider ? 1.0f : 0.0f);
+				field.format = spec->get_or<std::string>("format", field.type == Type::Int ? "%d" : field.type == Type::Text ? "%g" : "%.3f");
+				if (field.slider && field.min >= field.max) throw Fail("sliders need min < max");
+				// The format reaches printf with the field's value: a float for float and text fields, an int for int fields
+				if (field.type == Type::Int && !detail::FormatAccepts(field.format, "diuxXo")) throw Fail("format '" + field.format + "' must have one integer conversion such as %d");
+				if ((field.type == Type::Float || field.type == Type::Text) && !detail::FormatAccepts(field.format, "fFeEgGaA")) throw Fail("format '" + field.format + "' must have one floating-point conversion such as %.3f");
+
+				if (field.type == Type::Combo)
+				{
+					const sol::optional<sol::table> items{ spec->get<sol::optional<sol::table>>("items") };
+					if (!items) throw Fail("combo needs an items table");
+					for (std::size_t item = 1; item <= items->size(); item++) field.items.push_back(items->get_or<std::string>(item, "Missing"));
+				}
+				fields.push_back(std::move(field));
+			}
+			for (Field& field : fields)	// pointers into the strings, once they no longer move
+				for (const std::string& item : field.items) field.itemPointers.push_back(item.c_str());
+		}
+		PropertySpecs(PropertySpecs&&) = default;	// moving keeps the item strings, and the pointers into them, in place
+		PropertySpecs& operator=(PropertySpecs&&) = default;
+		PropertySpecs(const PropertySpecs&) = delete;
+		PropertySpecs& operator=(const PropertySpecs&) = delete;
 
-		return std::make_tuple(rgba, used);
-	}
-	inline std::tuple<sol::as_table_t<std::vector<float>>, bool> ColorPicker4(const std::string& label, const sol::table& col, int flags)
-	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		float color[4] = { float(r), float(g), float(b), float(a) };
-		bool used = ImGui::ColorPicker4(label.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		const std::vector<Field>& GetFields() const													{ return fields; }
+		int GetCount() const																		{ return static_cast<int>(fields.size()); }
 
-		sol::as_table_t rgba = sol::as_table(std::vector<float>{
-			color[0], color[1], color[2], color[3]
-		});
+	private:
+		std::vector<Field>	fields;
+	};
 
-		return std::make_tuple(rgba, used);
-	}
-	inline bool ColorButton(const std::string& desc_id, const sol::table& col)
+	inline PropertySpecs CreatePropertySpecs(const sol::table& specs)								{ return PropertySpecs{ specs }; }
+
+	// Two-column table of labels and widgets editing values[field]. Only the visible rows read their value, and only the
+	// fields the user changed are written back. Scrolls inside height pixels when given. Returns the number of changed fields.
+	inline int PropertyGrid(const std::string& id, const PropertySpecs& specs, sol::table values, sol::optional<float> height)
 	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		const ImVec4 color{ float(r), float(g), float(b), float(a) };
-		return ImGui::ColorButton(desc_id.c_str(), color);
+		SOL_IMGUI_ZONE("PropertyGrid");
+		using Type = PropertySpecs::Type;
+		const auto& fields{ specs.GetFields() };
+		const ImVec2 size{ 0.0f, height.value_or(0.0f) };
+		if (!ImGui::BeginTable(id.c_str(), 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingStretchProp | (height ? ImGuiTableFlags_ScrollY : 0), size)) return 0;
+
+		ImGui::TableSetupColumn("Property", ImGuiTableColumnFlags_WidthStretch, 0.4f);
+		ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch, 0.6f);
+
+		int changes{};
+		ImGuiListClipper clipper;
+		clipper.Begin(static_cast<int>(fields.size()));
+		while (clipper.Step())
+		{
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+			{
+				const PropertySpecs::Field& field{ fields[row] };
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted(field.label.c_str());
+				ImGui::TableNextColumn();
+				ImGui::PushID(row);
+				ImGui::SetNextItemWidth(-FLT_MIN);
+
+				const char* const label{ "##value" };
+				const char* const format{ field.format.c_str() };
+				switch (field.type)
+				{
+				case Type::Float:
+				{
+					float value{ values.get_or<float>(field.key, 0.0f) };
+					if (field.slider ? ImGui::SliderFloat(label, &value, field.min, field.max, format) : ImGui::DragFloat(label, &value, field.speed, field.min, field.max, format))
+					{
+						values.set(field.key, value);
+						changes++;
+					}
+					break;
+				}
+				case Type::Int:
+				{
+					int value{ values.get_or<int>(field.key, 0) };
+					if (field.slider ? ImGui::SliderInt(label, &value, static_cast<int>(field.min), static_cast<int>(field.max), format) : ImGui::DragInt(label, &value, field.speed, static_cast<int>(field.min), static_cast<int>(field.max), format))
+					{
+						values.set(field.key, value);
+						changes++;
+					}
+					break;
+				}
+				case Type::Bool:
+				{
+					bool value{ values.get_or<bool>(field.key, false) };
+					if (ImGui::Checkbox(label, &value))
+					{
+						values.set(field.key, value);
+						changes++;
+					}
+					break;
+				}
+				case Type::String:
+				{
+					std::string value{ values.get_or<std::string>(field.key, "") };
+					if (ImGui::InputText(label, &value))
+					{
+						values.set(field.key, value);
+						changes++;
+					}
+					break;
+				}
+				case Type::Combo:
+				{
+					int value{ values.get_or<int>(field.key, 0) };
+					if (ImGui::Combo(label, &value, field.itemPointers.data(), static_cast<int>(field.itemPointers.size())))
+					{
+						values.set(field.key, value);
+						changes++;
+					}
+					break;
+				}
+				case Type::Text:
+				{
+					const sol::object value{ values.get<sol::object>(field.key) };
+					switch (value.get_type())
+					{
+					case sol::type::string:		ImGui::TextUnformatted(value.as<std::string>().c_str()); break;
+					case sol::type::number:		ImGui::Text(format, value.as<double>()); break;
+					case sol::type::boolean:	ImGui::TextUnformatted(value.as<bool>() ? "true" : "false"); break;
+					default:					break;
+					}
+					break;
+				}
+				}
+				ImGui::PopID();
+			}
+		}
+		ImGui::EndTable();
+		return changes;
 	}
-	inline bool ColorButton(const std::string& desc_id, const sol::table& col, int flags)
+#endif
+#pragma endregion Property Grid
+
+#pragma region Reflection Inspector
+#ifdef SOL_IMGUI_ENABLE_INSPECTOR	// Define SOL_IMGUI_ENABLE_INSPECTOR to edit registered C++ types from Lua with ImGui.Inspect(object)
+	enum class InspectorWidget { Drag, Slider, Input };
+
+	namespace detail
 	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		const ImVec4 color{ float(r), float(g), float(b), float(a) };
-		return ImGui::ColorButton(desc_id.c_str(), color, static_cast<ImGuiColorEditFlags>(flags));
+		// Element type and count of the members an inspector edits: scalars, fixed arrays of scalars, ImVec2 and ImVec4
+		template <typename T> struct InspectorScalar								{ using Scalar = T; static constexpr int Components = 1; };
+		template <typename T, std::size_t N> struct InspectorScalar<T[N]>			{ using Scalar = T; static constexpr int Components = static_cast<int>(N); };
+		template <typename T, std::size_t N> struct InspectorScalar<std::array<T, N>>	{ using Scalar = T; static constexpr int Components = static_cast<int>(N); };
+		template <> struct InspectorScalar<ImVec2>									{ using Scalar = float; static constexpr int Components = 2; };
+		template <> struct InspectorScalar<ImVec4>									{ using Scalar = float; static constexpr int Components = 4; };
+
+		template <typename T>
+		constexpr ImGuiDataType DataTypeOf()
+		{
+			static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "inspector fields must be bool or made of arithmetic scalars");
+			static_assert(sizeof(T) <= 8, "ImGui edits scalars of at most 8 bytes");
+			static_assert(!std::is_floating_point_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double>, "ImGui only edits float and double floating-point scalars");
+			if constexpr (std::is_same_v<T, float>) return ImGuiDataType_Float;
+			else if constexpr (std::is_same_v<T, double>) return ImGuiDataType_Double;
+			else if constexpr (sizeof(T) == 1) return std::is_signed_v<T> ? ImGuiDataType_S8 : ImGuiDataType_U8;
+			else if constexpr (sizeof(T) == 2) return std::is_signed_v<T> ? ImGuiDataType_S16 : ImGuiDataType_U16;
+			else if constexpr (sizeof(T) == 4) return std::is_signed_v<T> ? ImGuiDataType_S32 : ImGuiDataType_U32;
+			else return std::is_signed_v<T> ? ImGuiDataType_S64 : ImGuiDataType_U64;
+		}
 	}
-	inline bool ColorButton(const std::string& desc_id, const sol::table& col, int flags, float sizeX, float sizeY)
+
+	// How ImGui.Inspect edits one registered C++ type: a list of fields, each edited in place with a
+	// DragScalarN, SliderScalarN or InputScalarN (or a Checkbox for bools) at its offset in the object.
+	class InspectorLayout
 	{
-		const lua_Number	r{ col[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ col[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ col[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ col[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		const ImVec4 color{ float(r), float(g), float(b), float(a) };
-		return ImGui::ColorButton(desc_id.c_str(), color, static_cast<ImGuiColorEditFlags>(flags), { sizeX, sizeY });
-	}
-	inline void SetColorEditOptions(int flags)																																			{ ImGui::SetColorEditOptions(static_cast<ImGuiColorEditFlags>(flags)); }
+	public:
+		explicit InspectorLayout(std::function<void*(const sol::object&)> resolve) : resolve(std::move(resolve)) {}
 
-	// Widgets: Trees
-	inline bool TreeNode(const std::string& label)														{ return ImGui::TreeNode(label.c_str()); }
-	inline bool TreeNode(const std::string& label, const std::string& fmt)								{ return ImGui::TreeNode(label.c_str(), fmt.c_str()); }
-	/* TODO: TreeNodeV(...) (2) ==> UNSUPPORTED */
-	inline bool TreeNodeEx(const std::string& label)													{ return ImGui::TreeNodeEx(label.c_str()); }
-	inline bool TreeNodeEx(const std::string& label, int flags)											{ return ImGui::TreeNodeEx(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags)); }
-	inline bool TreeNodeEx(const std::string& label, int flags, const std::string& fmt)					{ return ImGui::TreeNodeEx(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags), fmt.c_str()); }
-	/* TODO: TreeNodeExV(...) (2) ==> UNSUPPORTED */
-	inline void TreePush(const std::string& str_id)														{ ImGui::TreePush(str_id.c_str()); }
-	/* TODO: TreePush(const void*) ==> UNSUPPORTED */
-	inline void TreePop()																				{ ImGui::TreePop(); }
-	inline float GetTreeNodeToLabelSpacing()															{ return ImGui::GetTreeNodeToLabelSpacing(); }
-	inline bool CollapsingHeader(const std::string& label)												{ return ImGui::CollapsingHeader(label.c_str()); }
-	inline bool CollapsingHeader(const std::string& label, int flags)									{ return ImGui::CollapsingHeader(label.c_str(), static_cast<ImGuiTreeNodeFlags>(flags)); }
-	inline std::tuple<bool, bool> CollapsingHeader(const std::string& label, bool open)					{ bool notCollapsed = ImGui::CollapsingHeader(label.c_str(), &open); return std::make_tuple(open, notCollapsed); }
-	inline std::tuple<bool, bool> CollapsingHeader(const std::string& label, bool open, int flags)		{ bool notCollapsed = ImGui::CollapsingHeader(label.c_str(), &open, static_cast<ImGuiTreeNodeFlags>(flags)); return std::make_tuple(open, notCollapsed); }
-	inline void SetNextItemOpen(bool is_open)															{ ImGui::SetNextItemOpen(is_open); }
-	inline void SetNextItemOpen(bool is_open, int cond)													{ ImGui::SetNextItemOpen(is_open, static_cast<ImGuiCond>(cond)); }
+		// Sliders need min < max, drags clamp to the range when min < max
+		template <typename Class, typename Member>
+		InspectorLayout& Field(const std::string& name, Member Class::* member, InspectorWidget widget = InspectorWidget::Drag, double min = 0.0, double max = 0.0, float speed = 1.0f, const char* format = nullptr)
+		{
+			FieldInfo field;
+			field.name = name;
+			field.address = [member](void* object) -> void* { return &(static_cast<Class*>(object)->*member); };
+			if constexpr (std::is_same_v<Member, bool>)
+				field.checkbox = true;
+			else
+			{
+				using Scalar = typename detail::InspectorScalar<Member>::Scalar;
+				SetScalar(field, detail::DataTypeOf<Scalar>(), detail::InspectorScalar<Member>::Components, widget, speed, format);
+				SetRange(field, min, max);
+			}
+			fields.push_back(std::move(field));
+			return *this;
+		}
+		// For layouts only known at runtime: components values of dataType starting offset bytes into the object
+		InspectorLayout& Field(const std::string& name, std::size_t offset, ImGuiDataType dataType, int components = 1, InspectorWidget widget = InspectorWidget::Drag, double min = 0.0, double max = 0.0, float speed = 1.0f, const char* format = nullptr)
+		{
+			FieldInfo field;
+			field.name = name;
+			field.address = [offset](void* object) -> void* { return static_cast<char*>(object) + offset; };
+			SetScalar(field, dataType, components, widget, speed, format);
+			SetRange(field, min, max);
+			fields.push_back(std::move(field));
+			return *this;
+		}
 
-	// Widgets: Selectables
-	// TODO: Only one of Selectable variations is possible due to same parameters for Lua
-	inline bool Selectable(const std::string& label)													{ return ImGui::Selectable(label.c_str()); }
-	inline bool Selectable(const std::string& label, bool selected)										{ ImGui::Selectable(label.c_str(), &selected); return selected; }
-	inline bool Selectable(const std::string& label, bool selected, int flags)							{ ImGui::Selectable(label.c_str(), &selected, static_cast<ImGuiSelectableFlags>(flags)); return selected; }
-	inline bool Selectable(const std::string& label, bool selected, int flags, float sizeX, float sizeY){ ImGui::Selectable(label.c_str(), &selected, static_cast<ImGuiSelectableFlags>(flags), { sizeX, sizeY }); return selected; }
+		void* Resolve(const sol::object& object) const													{ return resolve(object); }
 
-	// Widgets: List Boxes
-	inline std::tuple<int, bool> ListBox(const std::string& label, int current_item, const sol::table& items, int items_count)
+		// Returns true when any field changed
+		bool Render(void* object) const
+		{
+			bool changed{};
+			for (const FieldInfo& field : fields)
+			{
+				const char* label{ field.name.c_str() };
+				const char* format{ field.format.empty() ? nullptr : field.format.c_str() };
+				void* value{ field.address(object) };
+				if (field.checkbox)
+				{
+					changed |= ImGui::Checkbox(label, static_cast<bool*>(value));
+					continue;
+				}
+				const void* min{ field.ranged ? &field.min : nullptr };
+				const void* max{ field.ranged ? &field.max : nullptr };
+				switch (field.widget)
+				{
+				case InspectorWidget::Drag:		changed |= ImGui::DragScalarN(label, field.dataType, value, field.components, field.speed, min, max, format); break;
+				case InspectorWidget::Slider:	changed |= ImGui::SliderScalarN(label, field.dataType, value, field.components, min, max, format); break;
+				case InspectorWidget::Input:	changed |= ImGui::InputScalarN(label, field.dataType, value, field.components, nullptr, nullptr, format); break;
+				}
+			}
+			return changed;
+		}
+
+	private:
+		struct FieldInfo
+		{
+			std::string						name;
+			std::function<void*(void*)>		address;
+			bool							checkbox{};
+			ImGuiDataType					dataType{};
+			int								components{ 1 };
+			InspectorWidget					widget{};
+			float							speed{ 1.0f };
+			std::string						format;
+			bool							ranged{};
+			std::uint64_t					min{}, max{};		// hold a value of dataType, which is what ImGui reads through p_min/p_max
+		};
+
+		static void SetScalar(FieldInfo& field, ImGuiDataType dataType, int components, InspectorWidget widget, float speed, const char* format)
+		{
+			field.dataType = dataType;
+			field.components = components;
+			field.widget = widget;
+			field.speed = speed;
+			if (format) field.format = format;
+		}
+		static void SetRange(FieldInfo& field, double min, double max)
+		{
+			field.ranged = min < max;
+			if (field.widget == InspectorWidget::Slider && !field.ranged) throw sol::error("inspector field '" + field.name + "': sliders need min < max");
+			field.min = detail::ScalarFromNumber(field.dataType, min);
+			field.max = detail::ScalarFromNumber(field.dataType, max);
+		}
+
+		std::function<void*(const sol::object&)>	resolve;
+		std::vector<FieldInfo>						fields;
+	};
+
+	namespace detail
 	{
-		std::vector<std::string> strings;
-		for (int i{ 1 }; i <= items_count; i++)
+		inline std::vector<std::pair<std::string, InspectorLayout>>& InspectorLayouts()
 		{
-			const auto& stringItem = items.get<sol::optional<std::string>>(i);
-			strings.push_back(stringItem.value_or("Missing"));
+			static std::vector<std::pair<std::string, InspectorLayout>> layouts;
+			return layouts;
 		}
+	}
 
-		std::vector<const char*> cstrings;
-		for (auto& string : strings)
-			cstrings.push_back(string.c_str());
+	// Registers, or replaces, the layout of Class, a type Lua holds as a sol2 usertype. Register layouts at startup,
+	// before any state calls ImGui.Inspect:
+	//     sol_ImGui::RegisterInspectorType<Transform>("Transform")
+	//         .Field("position", &Transform::position, sol_ImGui::InspectorWidget::Drag, -100.0, 100.0, 0.1f)
+	//         .Field("visible", &Transform::visible);
+	template <typename Class>
+	InspectorLayout& RegisterInspectorType(const std::string& name)
+	{
+		auto& layouts{ detail::InspectorLayouts() };
+		InspectorLayout layout{ [](const sol::object& object) -> void* { return object.is<Class*>() ? object.as<Class*>() : nullptr; } };
+		for (auto& [registered, existing] : layouts)
+			if (registered == name) return existing = std::move(layout);
+		return layouts.emplace_back(name, std::move(layout)).second;
+	}
 
-		bool clicked = ImGui::ListBox(label.c_str(), &current_item, cstrings.data(), items_count);
-		return std::make_tuple(current_item, clicked);
+	// Edits every registered field of object in place. Returns true when any field changed.
+	inline bool Inspect(const sol::object& object)
+	{
+		SOL_IMGUI_ZONE("Inspect");
+		for (const auto& [name, layout] : detail::InspectorLayouts())
+			if (void* address{ layout.Resolve(object) })
+			{
+				ImGui::PushID(address);
+				const bool changed{ layout.Render(address) };
+				ImGui::PopID();
+				return changed;
+			}
+		throw sol::error("ImGui.Inspect: no inspector layout is registered for this object's type");
 	}
-	inline std::tuple<int, bool> ListBox(const std::string& label, int current_item, const sol::table& items, int items_count, int height_in_items)
+#endif
+#pragma endregion Reflection Inspector
+
+#pragma region Unchecked Bindings
+#if defined(SOL_IMGUI_UNCHECKED) && defined(SOL_IMGUI_DEFINE_INIT)	// Define SOL_IMGUI_UNCHECKED to register the hot bindings as plain lua_CFunctions without argument checks
+	namespace detail
 	{
-		std::vector<std::string> strings;
-		for (int i{ 1 }; i <= items_count; i++)
+		template <typename T>
+		inline T UncheckedGet(lua_State* L, int index)
 		{
-			const auto& stringItem = items.get<sol::optional<std::string>>(i);
-			strings.push_back(stringItem.value_or("Missing"));
+			if constexpr (std::is_same_v<T, bool>)			return lua_toboolean(L, index) != 0;
+			else if constexpr (std::is_arithmetic_v<T>)		return static_cast<T>(lua_tonumber(L, index));
+			else
+			{
+				std::size_t length{};
+				const char* string{ lua_tolstring(L, index, &length) };
+				return string ? std::string(string, length) : std::string();
+			}
 		}
 
-		std::vector<const char*> cstrings;
-		for (auto& string : strings)
-			cstrings.push_back(string.c_str());
+		template <typename T>
+		inline int UncheckedPush(lua_State* L, const T& value)
+		{
+			if constexpr (std::is_same_v<T, bool>)				lua_pushboolean(L, value);
+			else if constexpr (std::is_integral_v<T>)			lua_pushinteger(L, static_cast<lua_Integer>(value));
+			else if constexpr (std::is_floating_point_v<T>)	lua_pushnumber(L, static_cast<lua_Number>(value));
+			else												lua_pushlstring(L, value.data(), value.size());
+			return 1;
+		}
+		template <typename... T>
+		inline int UncheckedPush(lua_State* L, const std::tuple<T...>& values)
+		{
+			return std::apply([L](const auto&... value) { return (UncheckedPush(L, value) + ... + 0); }, values);
+		}
 
-		bool clicked = ImGui::ListBox(label.c_str(), &current_item, cstrings.data(), items_count, height_in_items);
-		return std::make_tuple(current_item, clicked);
-	}
-	inline bool BeginListBox(const std::string& label, float sizeX, float sizeY)						{ return ImGui::BeginListBox(label.c_str(), { sizeX, sizeY }); }
-	inline bool BeginListBox(const std::string& label)													{ return ImGui::BeginListBox(label.c_str()); }
-	inline void EndListBox()																			{ ImGui::EndListBox(); }
+		template <typename R, typename... Args>
+		constexpr int Arity(R(*)(Args...))														{ return static_cast<int>(sizeof...(Args)); }
 
-	// Widgets: Data Plotting
-	/* TODO: Widgets Data Plotting ==> UNSUPPORTED (barely used and quite long functions) */
+		template <auto... Functions>
+		constexpr bool DistinctArities()
+		{
+			constexpr int arities[]{ Arity(Functions)... };
+			for (std::size_t i = 0; i < sizeof...(Functions); i++)
+				for (std::size_t j = i + 1; j < sizeof...(Functions); j++)
+					if (arities[i] == arities[j]) return false;
+			return true;
+		}
 
-	// Widgets: Value() helpers
-	inline void Value(const std::string& prefix, bool b)												{ ImGui::Value(prefix.c_str(), b); }
-	inline void Value(const std::string& prefix, int v)													{ ImGui::Value(prefix.c_str(), v); }
-	inline void Value(const std::string& prefix, unsigned int v)										{ ImGui::Value(prefix.c_str(), v); }
-	inline void Value(const std::string& prefix, float v)												{ ImGui::Value(prefix.c_str(), v); }
-	inline void Value(const std::string& prefix, float v, const std::string& float_format)				{ ImGui::Value(prefix.c_str(), v, float_format.c_str()); }
+		template <typename R, typename... Args, std::size_t... I>
+		inline int UncheckedInvoke(lua_State* L, R(*function)(Args...), std::index_sequence<I...>)
+		{
+			if constexpr (std::is_void_v<R>)
+			{
+				function(UncheckedGet<std::decay_t<Args>>(L, static_cast<int>(I) + 1)...);
+				return 0;
+			}
+			else return UncheckedPush(L, function(UncheckedGet<std::decay_t<Args>>(L, static_cast<int>(I) + 1)...));
+		}
 
-	// Widgets: Menus
-	inline bool BeginMenuBar()																			{ return ImGui::BeginMenuBar(); }
-	inline void EndMenuBar()																			{ ImGui::EndMenuBar(); }
-	inline bool BeginMainMenuBar()																		{ return ImGui::BeginMainMenuBar(); }
-	inline void EndMainMenuBar()																		{ ImGui::EndMainMenuBar(); }
-	inline bool BeginMenu(const std::string& label)														{ return ImGui::BeginMenu(label.c_str()); }
-	inline bool BeginMenu(const std::string& label, bool enabled)										{ return ImGui::BeginMenu(label.c_str(), enabled); }
-	inline void EndMenu()																				{ ImGui::EndMenu(); }
-	inline bool MenuItem(const std::string& label)																					{ return ImGui::MenuItem(label.c_str()); }
-	inline bool MenuItem(const std::string& label, const std::string& shortcut)														{ return ImGui::MenuItem(label.c_str(), shortcut.c_str()); }
-	inline std::tuple<bool, bool> MenuItem(const std::string& label, const std::string& shortcut, bool selected)					{ bool activated = ImGui::MenuItem(label.c_str(), shortcut.c_str(), &selected); return std::make_tuple(selected, activated); }
-	inline std::tuple<bool, bool> MenuItem(const std::string& label, const std::string& shortcut, bool selected, bool enabled)		{ bool activated = ImGui::MenuItem(label.c_str(), shortcut.c_str(), &selected, enabled); return std::make_tuple(selected, activated); }
+		// Reads the arguments as the parameter types without checking them and picks the overload by argument count alone.
+		// Nothing here throws, and the only Lua error raised is for an argument count no overload takes.
+		template <auto... Functions>
+		inline int UncheckedBinding(lua_State* L)
+		{
+			static_assert(DistinctArities<Functions...>(), "unchecked overloads must differ in their number of parameters");
+			const int count{ lua_gettop(L) };
+			int results{ -1 };
+			(void)((Arity(Functions) == count && ((results = UncheckedInvoke(L, Functions, std::make_index_sequence<Arity(Functions)>{})), true)) || ...);
+			return results >= 0 ? results : luaL_error(L, "wrong number of arguments (%d)", count);
+		}
 
-	// Tooltips
-	inline void BeginTooltip()																			{ ImGui::BeginTooltip(); }
-	inline void EndTooltip()																			{ ImGui::EndTooltip(); }
-	inline void SetTooltip(const std::string& fmt)														{ ImGui::SetTooltip(fmt.c_str()); }
-	inline void SetTooltipV()																			{ /* TODO: SetTooltipV(...) ==> UNSUPPORTED */ }
+		// The hottest bindings, replacing their sol2 registrations
+		inline void RegisterUncheckedBindings(sol::table& ImGui)
+		{
+			static constexpr std::pair<const char*, lua_CFunction> bindings[]
+			{
+			#if SOL_IMGUI_MODULE_WIDGETS
+				{ "Text", UncheckedBinding<sol::resolve<void(const std::string&)>(Text)> },
+				{ "TextColored", UncheckedBinding<sol::resolve<void(float, float, float, float, const std::string&)>(TextColored)> },
+				{ "TextDisabled", UncheckedBinding<sol::resolve<void(const std::string&)>(TextDisabled)> },
+				{ "TextWrapped", UncheckedBinding<sol::resolve<void(const std::string)>(TextWrapped)> },
+				{ "LabelText", UncheckedBinding<sol::resolve<void(const std::string&, const std::string&)>(LabelText)> },
+				{ "BulletText", UncheckedBinding<sol::resolve<void(const std::string&)>(BulletText)> },
+				{ "Button", UncheckedBinding<
+					sol::resolve<bool(const std::string&)>(Button),
+					sol::resolve<bool(const std::string&, float, float)>(Button)
+				> },
+				{ "SmallButton", UncheckedBinding<sol::resolve<bool(const std::string&)>(SmallButton)> },
+				{ "Checkbox", UncheckedBinding<sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(Checkbox)> },
+				{ "Selectable", UncheckedBinding<
+					sol::resolve<bool(const std::string&)>(Selectable),
+					sol::resolve<bool(const std::string&, bool)>(Selectable),
+					sol::resolve<bool(const std::string&, bool, int)>(Selectable),
+					sol::resolve<bool(const std::string&, bool, int, float, float)>(Selectable)
+				> },
+			#endif
+			#if SOL_IMGUI_MODULE_LAYOUT
+				{ "SameLine", UncheckedBinding<
+					sol::resolve<void()>(SameLine),
+					sol::resolve<void(float)>(SameLine),
+					sol::resolve<void(float, float)>(SameLine)
+				> },
+				{ "Separator", UncheckedBinding<sol::resolve<void()>(Separator)> },
+				{ "Spacing", UncheckedBinding<sol::resolve<void()>(Spacing)> },
+				{ "NewLine", UncheckedBinding<sol::resolve<void()>(NewLine)> },
+				{ "Indent", UncheckedBinding<
+					sol::resolve<void()>(Indent),
+					sol::resolve<void(float)>(Indent)
+				> },
+				{ "Unindent", UncheckedBinding<
+					sol::resolve<void()>(Unindent),
+					sol::resolve<void(float)>(Unindent)
+				> },
+				{ "Dummy", UncheckedBinding<sol::resolve<void(float, float)>(Dummy)> },
+				{ "SetNextItemWidth", UncheckedBinding<sol::resolve<void(float)>(SetNextItemWidth)> },
+				{ "PushItemWidth", UncheckedBinding<sol::resolve<void(float)>(PushItemWidth)> },
+				{ "PopItemWidth", UncheckedBinding<sol::resolve<void()>(PopItemWidth)> },
+				{ "PopID", UncheckedBinding<sol::resolve<void()>(PopID)> },
+				{ "PushStyleColor", UncheckedBinding<
+					sol::resolve<void(int, int)>(PushStyleColor),
+					sol::resolve<void(int, float, float, float, float)>(PushStyleColor)
+				> },
+				{ "PopStyleColor", UncheckedBinding<
+					sol::resolve<void()>(PopStyleColor),
+					sol::resolve<void(int)>(PopStyleColor)
+				> },
+				{ "PushStyleVar", UncheckedBinding<
+					sol::resolve<void(int, float)>(PushStyleVar),
+					sol::resolve<void(int, float, float)>(PushStyleVar)
+				> },
+				{ "PopStyleVar", UncheckedBinding<
+					sol::resolve<void()>(PopStyleVar),
+					sol::resolve<void(int)>(PopStyleVar)
+				> },
+			#endif
+			#if SOL_IMGUI_MODULE_WINDOWS
+				{ "Begin", UncheckedBinding<
+					sol::resolve<bool(const std::string&)>(Begin),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool)>(Begin),
+					sol::resolve<std::tuple<bool, bool>(const std::string&, bool, int)>(Begin)
+				> },
+				{ "End", UncheckedBinding<sol::resolve<void()>(End)> },
+				{ "BeginChild", UncheckedBinding<
+					sol::resolve<bool(const std::string&)>(BeginChild),
+					sol::resolve<bool(const std::string&, float)>(BeginChild),
+					sol::resolve<bool(const std::string&, float, float)>(BeginChild),
+					sol::resolve<bool(const std::string&, float, float, int)>(BeginChild),
+					sol::resolve<bool(const std::string&, float, float, int, int)>(BeginChild)
+				> },
+				{ "EndChild", UncheckedBinding<sol::resolve<void()>(EndChild)> },
+			#endif
+			#if SOL_IMGUI_MODULE_UTILITIES
+				{ "IsItemHovered", UncheckedBinding<
+					sol::resolve<bool()>(IsItemHovered),
+					sol::resolve<bool(int)>(IsItemHovered)
+				> },
+				{ "IsItemClicked", UncheckedBinding<
+					sol::resolve<bool()>(IsItemClicked),
+					sol::resolve<bool(int)>(IsItemClicked)
+				> },
+			#endif
+			#if SOL_IMGUI_MODULE_POPUPS
+				{ "SetTooltip", UncheckedBinding<sol::resolve<void(const std::string&)>(SetTooltip)> },
+			#endif
+			#if SOL_IMGUI_MODULE_WIDGETS
+				{ "TreeNode", UncheckedBinding<
+					sol::resolve<bool(const std::string&)>(TreeNode),
+					sol::resolve<bool(const std::string&, const std::string&)>(TreeNode)
+				> },
+				{ "TreePop", UncheckedBinding<sol::resolve<void()>(TreePop)> },
+				{ "ProgressBar", UncheckedBinding<
+					sol::resolve<void(float)>(ProgressBar),
+					sol::resolve<void(float, float, float)>(ProgressBar),
+					sol::resolve<void(float, float, float, const std::string&)>(ProgressBar)
+				> }
+			#endif
+			};
+
+			lua_State* L{ ImGui.lua_state() };
+			ImGui.push();
+			for (const auto& [name, function] : bindings)
+			{
+				lua_pushcfunction(L, function);
+				lua_setfield(L, -2, name);
+			}
+			lua_pop(L, 1);
+		}
+	}
+#endif
+#pragma endregion Unchecked Bindings
 
-	// Popups, Modals
-	inline bool BeginPopup(const std::string& str_id)													{ return ImGui::BeginPopup(str_id.c_str()); }
-	inline bool BeginPopup(const std::string& str_id, int flags)										{ return ImGui::BeginPopup(str_id.c_str(), static_cast<ImGuiWindowFlags>(flags)); }
-	inline bool BeginPopupModal(const std::string& name)												{ return ImGui::BeginPopupModal(name.c_str()); }
-	inline bool BeginPopupModal(const std::string& name, bool open)										{ return ImGui::BeginPopupModal(name.c_str(), &open); }
-	inline bool BeginPopupModal(const std::string& name, bool open, int flags)							{ return ImGui::BeginPopupModal(name.c_str(), &open, static_cast<ImGuiWindowFlags>(flags)); }
-	inline void EndPopup()																				{ ImGui::EndPopup(); }
-	inline void OpenPopup(const std::string& str_id)													{ ImGui::OpenPopup(str_id.c_str()); }
-	inline void OpenPopup(const std::string& str_id, int popup_flags)									{ ImGui::OpenPopup(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
-	inline void CloseCurrentPopup()																		{ ImGui::CloseCurrentPopup(); }
-	inline bool BeginPopupContextItem()																	{ return ImGui::BeginPopupContextItem(); }
-	inline bool BeginPopupContextItem(const std::string& str_id)										{ return ImGui::BeginPopupContextItem(str_id.c_str()); }
-	inline bool BeginPopupContextItem(const std::string& str_id, int popup_flags)						{ return ImGui::BeginPopupContextItem(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
-	inline bool BeginPopupContextWindow()																{ return ImGui::BeginPopupContextWindow(); }
-	inline bool BeginPopupContextWindow(const std::string& str_id)										{ return ImGui::BeginPopupContextWindow(str_id.c_str()); }
-	inline bool BeginPopupContextWindow(const std::string& str_id, int popup_flags)						{ return ImGui::BeginPopupContextWindow(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
-	inline bool BeginPopupContextVoid()																	{ return ImGui::BeginPopupContextVoid(); }
-	inline bool BeginPopupContextVoid(const std::string& str_id)										{ return ImGui::BeginPopupContextVoid(str_id.c_str()); }
-	inline bool BeginPopupContextVoid(const std::string& str_id, int popup_flags)						{ return ImGui::BeginPopupContextVoid(str_id.c_str(), static_cast<ImGuiPopupFlags>(popup_flags)); }
-	inline bool IsPopupOpen(const std::string& str_id)													{ return ImGui::IsPopupOpen(str_id.c_str()); }
-	inline bool IsPopupOpen(const std::string& str_id, int popup_flags)									{ return ImGui::IsPopupOpen(str_id.c_str(), popup_flags); }
+#pragma region Lean Bindings
+#if defined(SOL_IMGUI_LEAN_BINDINGS) && defined(SOL_IMGUI_DEFINE_INIT)	// Define SOL_IMGUI_LEAN_BINDINGS to share the binding and enum descriptions between all Lua states
+	namespace detail
+	{
+		using LeanOverload = bool(*)(lua_State* L, void(*function)(), int& results);
 
-	// Columns
-	inline void Columns()																				{ ImGui::Columns(); }
-	inline void Columns(int count)																		{ ImGui::Columns(count); }
-	inline void Columns(int count, const std::string& id)												{ ImGui::Columns(count, id.c_str()); }
-	inline void Columns(int count, const std::string& id, bool border)									{ ImGui::Columns(count, id.c_str(), border); }
-	inline void NextColumn()																			{ ImGui::NextColumn(); }
-	inline int GetColumnIndex()																			{ return ImGui::GetColumnIndex(); }
-	inline float GetColumnWidth()																		{ return ImGui::GetColumnWidth(); }
-	inline float GetColumnWidth(int column_index)														{ return ImGui::GetColumnWidth(column_index); }
-	inline void SetColumnWidth(int column_index, float width)											{ ImGui::SetColumnWidth(column_index, width); }
-	inline float GetColumnOffset()																		{ return ImGui::GetColumnOffset(); }
-	inline float GetColumnOffset(int column_index)														{ return ImGui::GetColumnOffset(column_index); }
-	inline void SetColumnOffset(int column_index, float offset_x)										{ ImGui::SetColumnOffset(column_index, offset_x); }
-	inline int GetColumnsCount()																		{ return ImGui::GetColumnsCount(); }
+		// Process-wide description of one ImGui.* function. Each state only holds a small C closure pointing at it.
+		struct LeanBinding
+		{
+			std::string										name;
+			std::vector<std::pair<void(*)(), LeanOverload>>	overloads;	// function pointer, stored as void(*)(), and its caller
+		};
+
+		template <typename T>
+		inline constexpr bool IsLeanParameter{ std::is_arithmetic_v<T> || std::is_same_v<T, std::string> || std::is_same_v<T, sol::table> };
+
+		// Plain function pointers and overload sets of them, taking numbers, booleans, strings and tables
+		template <typename Function>
+		struct IsLeanFunction : std::false_type {};
+		template <typename R, typename... Args>
+		struct IsLeanFunction<R(*)(Args...)> : std::bool_constant<(IsLeanParameter<std::decay_t<Args>> && ...)> {};
+		template <typename... Functions>
+		struct IsLeanFunction<sol::overload_set<Functions...>> : std::bool_constant<(IsLeanFunction<Functions>::value && ...)> {};
+
+		template <typename R, typename... Args, std::size_t... I>
+		inline bool CallLeanOverload(lua_State* L, void(*erased)(), int& results, std::index_sequence<I...>)
+		{
+			if (lua_gettop(L) != static_cast<int>(sizeof...(Args)) || !(sol::stack::check<std::decay_t<Args>>(L, static_cast<int>(I) + 1) && ...)) return false;
+			const auto function{ reinterpret_cast<R(*)(Args...)>(erased) };
+			if constexpr (std::is_void_v<R>)
+			{
+				function(sol::stack::get<std::decay_t<Args>>(L, static_cast<int>(I) + 1)...);
+				results = 0;
+			}
+			else results = sol::stack::push(L, function(sol::stack::get<std::decay_t<Args>>(L, static_cast<int>(I) + 1)...));
+			return true;
+		}
+		template <typename R, typename... Args>
+		inline bool CallLeanOverload(lua_State* L, void(*erased)(), int& results)					{ return CallLeanOverload<R, Args...>(L, erased, results, std::index_sequence_for<Args...>{}); }
 
-	// Tab Bars, Tabs
-	inline bool BeginTabBar(const std::string& str_id)													{ return ImGui::BeginTabBar(str_id.c_str()); }
-	inline bool BeginTabBar(const std::string& str_id, int flags)										{ return ImGui::BeginTabBar(str_id.c_str(), static_cast<ImGuiTabBarFlags>(flags)); }
-	inline void EndTabBar()																				{ ImGui::EndTabBar(); }
-	inline bool BeginTabItem(const std::string& label)													{ return ImGui::BeginTabItem(label.c_str()); }
-	inline std::tuple<bool, bool> BeginTabItem(const std::string& label, bool open)						{ bool selected = ImGui::BeginTabItem(label.c_str(), &open); return std::make_tuple(open, selected); }
-	inline std::tuple<bool, bool> BeginTabItem(const std::string& label, bool open, int flags)			{ bool selected = ImGui::BeginTabItem(label.c_str(), &open, static_cast<ImGuiTabItemFlags>(flags)); return std::make_tuple(open, selected); }
-	inline void EndTabItem()																			{ ImGui::EndTabItem(); }
-	inline void SetTabItemClosed(const std::string& tab_or_docked_window_label)							{ ImGui::SetTabItemClosed(tab_or_docked_window_label.c_str()); }
+		template <typename R, typename... Args>
+		inline void AddLeanOverload(LeanBinding& binding, R(*function)(Args...))
+		{
+			binding.overloads.emplace_back(reinterpret_cast<void(*)()>(function), static_cast<LeanOverload>(&CallLeanOverload<R, Args...>));
+		}
+		template <typename R, typename... Args>
+		inline void AddLeanOverloads(LeanBinding& binding, R(*function)(Args...))					{ AddLeanOverload(binding, function); }
+		template <typename... Functions>
+		inline void AddLeanOverloads(LeanBinding& binding, const sol::overload_set<Functions...>& set)
+		{
+			std::apply([&binding](const auto&... function) { (AddLeanOverload(binding, function), ...); }, set.functions);
+		}
 
-	// Docking
-	#ifndef IMGUI_NO_DOCKING	// Define IMGUI_NO_DOCKING to disable these for compatibility with ImGui's master branch
-	inline void DockSpace(unsigned int id)																{ ImGui::DockSpace(id); }
-	inline void DockSpace(unsigned int id, float sizeX, float sizeY)									{ ImGui::DockSpace(id, { sizeX, sizeY }); }
-	inline void DockSpace(unsigned int id, float sizeX, float sizeY, int flags)							{ ImGui::DockSpace(id, { sizeX, sizeY }, static_cast<ImGuiDockNodeFlags>(flags)); }
-	inline unsigned int DockSpaceOverViewport()															{ return 0; /* TODO: DockSpaceOverViwport(...) ==> UNSUPPORTED */ }
-	inline void SetNextWindowDockID(unsigned int dock_id)												{ ImGui::SetNextWindowDockID(dock_id); }
-	inline void SetNextWindowDockID(unsigned int dock_id, int cond)										{ ImGui::SetNextWindowDockID(dock_id, static_cast<ImGuiCond>(cond)); }
-	inline void SetNextWindowClass()																	{  /* TODO: SetNextWindowClass(...) ==> UNSUPPORTED */ }
-	inline unsigned int GetWindowDockID()																{ return ImGui::GetWindowDockID(); }
-	inline bool IsWindowDocked()																		{ return ImGui::IsWindowDocked(); }
-	#endif
+		// Tries the overloads in registration order, as sol::overload does
+		inline int LeanDispatch(lua_State* L)
+		{
+			const auto& binding{ *static_cast<const LeanBinding*>(lua_touserdata(L, lua_upvalueindex(1))) };
+			try
+			{
+				int results{};
+				for (const auto& [function, call] : binding.overloads)
+					if (call(L, function, results)) return results;
+				lua_pushfstring(L, "ImGui.%s: no overload takes these arguments", binding.name.c_str());
+			}
+			catch (const std::exception& error)
+			{
+				lua_pushstring(L, error.what());
+			}
+			return lua_error(L);
+		}
 
-	// Logging
-	inline void LogToTTY()																				{ ImGui::LogToTTY(); }
-	inline void LogToTTY(int auto_open_depth)															{ ImGui::LogToTTY(auto_open_depth); }
-	inline void LogToFile()																				{ ImGui::LogToFile(); }
-	inline void LogToFile(int auto_open_depth)															{ ImGui::LogToFile(auto_open_depth); }
-	inline void LogToFile(int auto_open_depth, const std::string& filename)								{ ImGui::LogToFile(auto_open_depth, filename.c_str()); }
-	inline void LogToClipboard()																		{ ImGui::LogToClipboard(); }
-	inline void LogToClipboard(int auto_open_depth)														{ ImGui::LogToClipboard(auto_open_depth); }
-	inline void LogFinish()																				{ ImGui::LogFinish(); }
-	inline void LogButtons()																			{ ImGui::LogButtons(); }
-	inline void LogText(const std::string& fmt)															{ ImGui::LogText(fmt.c_str()); }
+		struct LeanRegistry
+		{
+			std::unordered_map<std::string, LeanBinding>								bindings;
+			std::unordered_map<std::string, std::unordered_map<std::string, lua_Integer>>	enums;
+			std::mutex																	mutex;
+		};
+		inline LeanRegistry& LeanDescriptions()													{ static LeanRegistry registry; return registry; }
+
+		template <typename Function>
+		inline void SetLeanBinding(sol::table& ImGui, const char* name, Function&& function)
+		{
+			using F = std::decay_t<Function>;
+			if constexpr (IsLeanFunction<F>::value)
+			{
+				LeanRegistry& registry{ LeanDescriptions() };
+				LeanBinding* binding;
+				{
+					const std::lock_guard<std::mutex> lock{ registry.mutex };
+					const auto [it, inserted]{ registry.bindings.try_emplace(name) };
+					binding = &it->second;
+					if (inserted)
+					{
+						binding->name = name;
+						AddLeanOverloads(*binding, static_cast<const F&>(function));
+					}
+				}
+
+				lua_State* L{ ImGui.lua_state() };
+				ImGui.push();
+				lua_pushlightuserdata(L, binding);
+				lua_pushcclosure(L, LeanDispatch, 1);
+				lua_setfield(L, -2, name);
+				lua_pop(L, 1);
+			}
+			else ImGui.set_function(name, std::forward<Function>(function));
+		}
 
-	// Drag and Drop
-	// TODO: Drag and Drop ==> UNSUPPORTED
+		// Stands in for the ImGui table in Init
+		class LeanBindingTable
+		{
+		public:
+			explicit LeanBindingTable(sol::table table) : table(std::move(table)) {}
 
-	// Clipping
-	inline void PushClipRect(float min_x, float min_y, float max_x, float max_y, bool intersect_current) { ImGui::PushClipRect({ min_x, min_y }, { max_x, max_y }, intersect_current); }
-	inline void PopClipRect()																			{ ImGui::PopClipRect(); }
+			template <typename Function>
+			void set_function(const char* name, Function&& function)								{ SetLeanBinding(table, name, std::forward<Function>(function)); }
 
-	// Focus, Activation
-	inline void SetItemDefaultFocus()																	{ ImGui::SetItemDefaultFocus(); }
-	inline void SetKeyboardFocusHere()																	{ ImGui::SetKeyboardFocusHere(); }
-	inline void SetKeyboardFocusHere(int offset)														{ ImGui::SetKeyboardFocusHere(offset); }
+			operator sol::table&()																{ return table; }
 
-	// Item/Widgets Utilities
-	inline bool IsItemHovered()																			{ return ImGui::IsItemHovered(); }
-	inline bool IsItemHovered(int flags)																{ return ImGui::IsItemHovered(static_cast<ImGuiHoveredFlags>(flags)); }
-	inline bool IsItemActive()																			{ return ImGui::IsItemActive(); }
-	inline bool IsItemFocused()																			{ return ImGui::IsItemFocused(); }
-	inline bool IsItemClicked()																			{ return ImGui::IsItemClicked(); }
-	inline bool IsItemClicked(int mouse_button)															{ return ImGui::IsItemClicked(static_cast<ImGuiMouseButton>(mouse_button)); }
-	inline bool IsItemVisible()																			{ return ImGui::IsItemVisible(); }
-	inline bool IsItemEdited()																			{ return ImGui::IsItemEdited(); }
-	inline bool IsItemActivated()																		{ return ImGui::IsItemActivated(); }
-	inline bool IsItemDeactivated()																		{ return ImGui::IsItemDeactivated(); }
-	inline bool IsItemDeactivatedAfterEdit()															{ return ImGui::IsItemDeactivatedAfterEdit(); }
-	inline bool IsItemToggledOpen()																		{ return ImGui::IsItemToggledOpen(); }
-	inline bool IsAnyItemHovered()																		{ return ImGui::IsAnyItemHovered(); }
-	inline bool IsAnyItemActive()																		{ return ImGui::IsAnyItemActive(); }
-	inline bool IsAnyItemFocused()																		{ return ImGui::IsAnyItemFocused(); }
-	inline std::tuple<float, float> GetItemRectMin()													{ const auto vec2{ ImGui::GetItemRectMin() }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetItemRectMax()													{ const auto vec2{ ImGui::GetItemRectMax() }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetItemRectSize()													{ const auto vec2{ ImGui::GetItemRectSize() }; return std::make_tuple(vec2.x, vec2.y); }
-	inline void SetNextItemAllowOverlap()																{ ImGui::SetNextItemAllowOverlap(); }
+		private:
+			sol::table table;
+		};
 
-	// Miscellaneous Utilities
-	inline bool IsRectVisible(float sizeX, float sizeY)													{ return ImGui::IsRectVisible({ sizeX, sizeY }); }
-	inline bool IsRectVisible(float minX, float minY, float maxX, float maxY)							{ return ImGui::IsRectVisible({ minX, minY }, { maxX, maxY }); }
-	inline double GetTime()																				{ return ImGui::GetTime(); }
-	inline int GetFrameCount()																			{ return ImGui::GetFrameCount(); }
-	/* TODO: GetBackgroundDrawList(), GetForeGroundDrawList(), GetDrawListSharedData() ==> UNSUPPORTED */
-	inline std::string GetStyleColorName(int idx)														{ return std::string(ImGui::GetStyleColorName(static_cast<ImGuiCol>(idx))); }
-	/* TODO: SetStateStorage(), GetStateStorage(), CalcListClipping() ==> UNSUPPORTED */
-	//inline bool BeginChild(unsigned int id, float sizeX, float sizeY)								{ return ImGui::BeginChild(id, { sizeX, sizeY }); }
-	//inline bool BeginChild(unsigned int id, float sizeX, float sizeY, int flags)					{ return ImGui::BeginChild(id, { sizeX, sizeY }, static_cast<ImGuiWindowFlags>(flags)); }
-	//inline void EndChild()																			{ return ImGui::EndChild(); }
+		// __index of a lean enum table: upvalue 1 is its shared description. Values are cached in the table once read.
+		inline int LeanEnumIndex(lua_State* L)
+		{
+			const auto& values{ *static_cast<const std::unordered_map<std::string, lua_Integer>*>(lua_touserdata(L, lua_upvalueindex(1))) };
+			if (lua_type(L, 2) != LUA_TSTRING) return 0;
+			const auto value{ values.find(lua_tostring(L, 2)) };
+			if (value == values.end()) return 0;
+			lua_pushvalue(L, 2);
+			lua_pushinteger(L, value->second);
+			lua_rawset(L, 1);
+			lua_pushinteger(L, value->second);
+			return 1;
+		}
+		inline int LeanEnumNewIndex(lua_State* L)												{ return luaL_error(L, "enum tables are read-only"); }
 
-	// Text Utilities
-	inline std::tuple<float, float> CalcTextSize(const std::string& text)																					{ const auto vec2{ ImGui::CalcTextSize(text.c_str()) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end)														{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str()) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end, bool hide_text_after_double_hash)					{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> CalcTextSize(const std::string& text, const std::string& text_end, bool hide_text_after_double_hash, float wrap_width)	{ const auto vec2{ ImGui::CalcTextSize(text.c_str(), text_end.c_str(), hide_text_after_double_hash, wrap_width) }; return std::make_tuple(vec2.x, vec2.y); }
+		inline void AddLeanEnumValues(std::unordered_map<std::string, lua_Integer>&) {}
+		template <typename Value, typename... Rest>
+		inline void AddLeanEnumValues(std::unordered_map<std::string, lua_Integer>& values, const char* key, Value value, Rest&&... rest)
+		{
+			values.emplace(key, static_cast<lua_Integer>(value));
+			AddLeanEnumValues(values, std::forward<Rest>(rest)...);
+		}
 
-	// Color Utilities
-	inline sol::as_table_t<std::vector<float>> ColorConvertU32ToFloat4(unsigned int in)
+		template <typename... Args>
+		inline void RegisterLeanEnum(lua_State* L, const char* name, Args&&... args)
+		{
+			LeanRegistry& registry{ LeanDescriptions() };
+			std::unordered_map<std::string, lua_Integer>* values;
+			{
+				const std::lock_guard<std::mutex> lock{ registry.mutex };
+				const auto [it, inserted]{ registry.enums.try_emplace(name) };
+				values = &it->second;
+				if (inserted) AddLeanEnumValues(*values, std::forward<Args>(args)...);
+			}
+
+			lua_newtable(L);
+			lua_createtable(L, 0, 2);
+			lua_pushlightuserdata(L, values);
+			lua_pushcclosure(L, LeanEnumIndex, 1);
+			lua_setfield(L, -2, "__index");
+			lua_pushcfunction(L, LeanEnumNewIndex);
+			lua_setfield(L, -2, "__newindex");
+			lua_setmetatable(L, -2);
+			lua_setglobal(L, name);
+		}
+	}
+#endif
+#pragma endregion Lean Bindings
+
+#pragma region Lazy Registration
+#if defined(SOL_IMGUI_LAZY_BINDINGS) && defined(SOL_IMGUI_DEFINE_INIT)	// Define SOL_IMGUI_LAZY_BINDINGS to create each ImGui.* binding on first access instead of in Init
+	namespace detail
 	{
-		const auto vec4 = ImGui::ColorConvertU32ToFloat4(in);
-		sol::as_table_t rgba = sol::as_table(std::vector<float>{
-			vec4.x, vec4.y, vec4.z, vec4.w
-		});
+		using BindingFactory = std::function<void(sol::table& ImGui, const char* name)>;
 
-		return rgba;
+		// Filled by the first Init of the process and read-only afterwards
+		struct LazyBindings
+		{
+			std::unordered_map<std::string, BindingFactory>	factories;
+			std::mutex										mutex;
+			std::atomic<bool>								recorded{};
+		};
+		inline LazyBindings& LazyRegistry()														{ static LazyBindings registry; return registry; }
+
+		// __index of the ImGui table: creates the binding, caches it in the table and returns it
+		inline int MaterializeBinding(lua_State* L)
+		{
+			if (lua_type(L, 2) != LUA_TSTRING) return 0;
+			const char* name{ lua_tostring(L, 2) };
+			const auto& factories{ LazyRegistry().factories };
+			const auto factory{ factories.find(name) };
+			if (factory == factories.end()) return 0;
+
+			// Called from Lua through a raw C function: no exception may leave it, and luaL_error must only
+			// longjmp once every C++ object here is destroyed
+			bool failed{};
+			char error[256]{};
+			try
+			{
+				sol::table ImGui{ L, 1 };
+				factory->second(ImGui, factory->first.c_str());
+			#ifdef SOL_IMGUI_INSTRUMENT_BINDINGS
+				InstrumentBinding(L, 1, factory->first.c_str());
+			#endif
+			}
+			catch (const std::exception& exception)
+			{
+				failed = true;
+				std::snprintf(error, sizeof(error), "%s", exception.what());
+			}
+			if (failed) return luaL_error(L, "ImGui.%s: %s", name, error);
+
+			lua_pushvalue(L, 2);
+			lua_rawget(L, 1);
+			return 1;
+		}
+
+		// Stands in for the ImGui table in Init. The first Init records how to create every binding and later ones
+		// skip straight to Install(), so a state only pays for the bindings its scripts touch.
+		class LazyBindingTable
+		{
+		public:
+			explicit LazyBindingTable(sol::table table)
+				: table(std::move(table))
+			{
+				LazyBindings& registry{ LazyRegistry() };
+				if (registry.recorded) return;
+				lock = std::unique_lock<std::mutex>(registry.mutex);
+				recording = !registry.recorded;
+			}
+
+			template <typename Function>
+			void set_function(const char* name, Function&& function)
+			{
+				if (!recording) return;
+				LazyRegistry().factories.try_emplace(name,
+					[function = std::forward<Function>(function)](sol::table& ImGui, const char* key)
+					{
+					#ifdef SOL_IMGUI_LEAN_BINDINGS
+						SetLeanBinding(ImGui, key, function);
+					#else
+						ImGui.set_function(key, function);
+					#endif
+					});
+			}
+
+			void Install()
+			{
+				if (recording) LazyRegistry().recorded = true;
+				recording = false;
+				if (lock.owns_lock()) lock.unlock();
+
+				lua_State* L{ table.lua_state() };
+				table.push();
+				lua_createtable(L, 0, 1);
+				lua_pushcfunction(L, MaterializeBinding);
+				lua_setfield(L, -2, "__index");
+				lua_setmetatable(L, -2);
+				lua_pop(L, 1);
+			}
+
+			operator sol::table&()																{ return table; }
+
+		private:
+			sol::table						table;
+			std::unique_lock<std::mutex>	lock;
+			bool							recording{};
+		};
 	}
-	inline unsigned int ColorConvertFloat4ToU32(const sol::table& rgba)
+#endif
+#pragma endregion Lazy Registration
+
+#pragma region LuaJIT FFI
+#ifdef SOL_IMGUI_ENABLE_FFI	// Define SOL_IMGUI_ENABLE_FFI to also export the hot bindings as extern "C" functions LuaJIT can call from compiled traces
+	// Return type, name after the sol_ImGui_ prefix and parameters of each exported function, defined at the end of this file.
+	// Outputs go through pointers, such as ffi.new("float[3]") for DragFloat3. A NULL format uses ImGui's default.
+	#define SOL_IMGUI_FFI_FUNCTIONS(X)																																		\
+	X(bool,			Begin,						(const char* name, bool* open, int flags))																						\
+	X(void,			End,						(void))																															\
+	X(bool,			BeginChild,					(const char* name, float sizeX, float sizeY, int childFlags, int flags))														\
+	X(void,			EndChild,					(void))																															\
+	X(void,			SameLine,					(float offsetFromStartX, float spacing))																						\
+	X(void,			Separator,					(void))																															\
+	X(void,			Spacing,					(void))																															\
+	X(void,			NewLine,					(void))																															\
+	X(void,			Dummy,						(float sizeX, float sizeY))																										\
+	X(void,			Indent,						(float indentW))																												\
+	X(void,			Unindent,					(float indentW))																												\
+	X(void,			SetNextItemWidth,			(float itemWidth))																												\
+	X(void,			PushItemWidth,				(float itemWidth))																												\
+	X(void,			PopItemWidth,				(void))																															\
+	X(void,			PushID,						(const char* stringID))																											\
+	X(void,			PushIDInt,					(int intID))																													\
+	X(void,			PopID,						(void))																															\
+	X(void,			PushStyleColor,				(int idx, float colR, float colG, float colB, float colA))																		\
+	X(void,			PopStyleColor,				(int count))																													\
+	X(void,			PushStyleVar,				(int idx, float val))																											\
+	X(void,			PushStyleVar2,				(int idx, float valX, float valY))																								\
+	X(void,			PopStyleVar,				(int count))																													\
+	X(void,			Text,						(const char* text))																												\
+	X(void,			TextColored,				(float colR, float colG, float colB, float colA, const char* text))																\
+	X(void,			TextDisabled,				(const char* text))																												\
+	X(void,			TextWrapped,				(const char* text))																												\
+	X(void,			LabelText,					(const char* label, const char* text))																							\
+	X(void,			BulletText,					(const char* text))																												\
+	X(bool,			Button,						(const char* label, float sizeX, float sizeY))																					\
+	X(bool,			SmallButton,				(const char* label))																											\
+	X(bool,			Checkbox,					(const char* label, bool* v))																									\
+	X(void,			ProgressBar,				(float fraction, float sizeX, float sizeY, const char* overlay))																\
+	X(bool,			Selectable,					(const char* label, bool selected, int flags, float sizeX, float sizeY))														\
+	X(bool,			TreeNode,					(const char* label))																											\
+	X(void,			TreePop,					(void))																															\
+	X(bool,			DragFloat,					(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags))							\
+	X(bool,			DragFloat2,					(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags))							\
+	X(bool,			DragFloat3,					(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags))							\
+	X(bool,			DragFloat4,					(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags))							\
+	X(bool,			DragInt,					(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags))								\
+	X(bool,			DragInt2,					(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags))								\
+	X(bool,			DragInt3,					(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags))								\
+	X(bool,			DragInt4,					(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags))								\
+	X(bool,			SliderFloat,				(const char* label, float* v, float v_min, float v_max, const char* format, int flags))											\
+	X(bool,			SliderFloat2,				(const char* label, float* v, float v_min, float v_max, const char* format, int flags))											\
+	X(bool,			SliderFloat3,				(const char* label, float* v, float v_min, float v_max, const char* format, int flags))											\
+	X(bool,			SliderFloat4,				(const char* label, float* v, float v_min, float v_max, const char* format, int flags))											\
+	X(bool,			SliderAngle,				(const char* label, float* v_rad, float v_degrees_min, float v_degrees_max, const char* format, int flags))						\
+	X(bool,			SliderInt,					(const char* label, int* v, int v_min, int v_max, const char* format, int flags))												\
+	X(bool,			SliderInt2,					(const char* label, int* v, int v_min, int v_max, const char* format, int flags))												\
+	X(bool,			SliderInt3,					(const char* label, int* v, int v_min, int v_max, const char* format, int flags))												\
+	X(bool,			SliderInt4,					(const char* label, int* v, int v_min, int v_max, const char* format, int flags))												\
+	X(bool,			IsItemHovered,				(int flags))																													\
+	X(bool,			IsItemClicked,				(int mouseButton))																												\
+	X(void,			SetTooltip,					(const char* text))																												\
+	X(unsigned int,	GetColorU32,				(float colR, float colG, float colB, float colA))																				\
+	X(ImDrawList*,	GetWindowDrawList,			(void))																															\
+	X(ImDrawList*,	GetBackgroundDrawList,		(void))																															\
+	X(ImDrawList*,	GetForegroundDrawList,		(void))																															\
+	X(void,			DrawList_AddLine,			(ImDrawList* drawList, float x1, float y1, float x2, float y2, unsigned int col, float thickness))								\
+	X(void,			DrawList_AddRect,			(ImDrawList* drawList, float x1, float y1, float x2, float y2, unsigned int col, float rounding, int flags, float thickness))	\
+	X(void,			DrawList_AddRectFilled,		(ImDrawList* drawList, float x1, float y1, float x2, float y2, unsigned int col, float rounding, int flags))						\
+	X(void,			DrawList_AddCircle,			(ImDrawList* drawList, float centerX, float centerY, float radius, unsigned int col, int segments, float thickness))				\
+	X(void,			DrawList_AddCircleFilled,	(ImDrawList* drawList, float centerX, float centerY, float radius, unsigned int col, int segments))								\
+	X(void,			DrawList_AddTriangle,		(ImDrawList* drawList, float x1, float y1, float x2, float y2, float x3, float y3, unsigned int col, float thickness))			\
+	X(void,			DrawList_AddTriangleFilled,	(ImDrawList* drawList, float x1, float y1, float x2, float y2, float x3, float y3, unsigned int col))							\
+	X(void,			DrawList_AddText,			(ImDrawList* drawList, float posX, float posY, unsigned int col, const char* text))												\
+	X(void,			DrawList_PathClear,			(ImDrawList* drawList))																											\
+	X(void,			DrawList_PathLineTo,		(ImDrawList* drawList, float posX, float posY))																					\
+	X(void,			DrawList_PathStroke,		(ImDrawList* drawList, unsigned int col, int flags, float thickness))															\
+	X(void,			DrawList_PathFillConvex,	(ImDrawList* drawList, unsigned int col))
+
+	// C declarations of the exported functions, for ffi.cdef
+	inline const char* GetFFIDeclarations()
 	{
-		const lua_Number	r{ rgba[1].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							g{ rgba[2].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							b{ rgba[3].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) },
-							a{ rgba[4].get<std::optional<lua_Number>>().value_or(static_cast<lua_Number>(0)) };
-		
-		return ImGui::ColorConvertFloat4ToU32({ float(r), float(g), float(b), float(a) });
+	#define SOL_IMGUI_FFI_CDEF(ret, name, params) #ret " sol_ImGui_" #name #params ";\n"
+		static constexpr const char* declarations{ "typedef struct ImDrawList ImDrawList;\n" SOL_IMGUI_FFI_FUNCTIONS(SOL_IMGUI_FFI_CDEF) };
+	#undef SOL_IMGUI_FFI_CDEF
+		return declarations;
 	}
+#endif
+#pragma endregion LuaJIT FFI
 
-	inline std::tuple<float, float, float> ColorConvertRGBtoHSV(float r, float g, float b)
-	{
-		float h{}, s{}, v{};
-		ImGui::ColorConvertRGBtoHSV(r, g, b, h, s, v);
-		return std::make_tuple(h, s, v);
-	}
-	inline std::tuple<float, float, float> ColorConvertHSVtoRGB(float h, float s, float v)
+#ifdef SOL_IMGUI_DEFINE_INIT
+	namespace detail
 	{
-		float r{}, g{}, b{};
-		ImGui::ColorConvertHSVtoRGB(h, s, v, r, g, b);
-		return std::make_tuple(r, g, b);
+		// Read-only sol::new_enum tables by default. With SOL_IMGUI_FLAT_ENUMS they are plain tables instead, whose fields
+		// are read without going through the __index/__newindex metamethods of the read-only proxy. With SOL_IMGUI_LEAN_BINDINGS
+		// they start empty and read their values from a description shared by all states.
+		template <typename SolStateOrView, typename... Args>
+		inline void RegisterEnum(SolStateOrView& lua, const char* name, Args&&... args)
+		{
+		#if defined(SOL_IMGUI_LEAN_BINDINGS)
+			RegisterLeanEnum(lua.lua_state(), name, std::forward<Args>(args)...);
+		#elif defined(SOL_IMGUI_FLAT_ENUMS)
+			lua.create_named_table(name, std::forward<Args>(args)...);
+		#else
+			lua.new_enum(name, std::forward<Args>(args)...);
+		#endif
+		}
 	}
 
-	// Inputs Utilities: Keyboard
-	//inline int GetKeyIndex(int imgui_key)																{ return ImGui::GetKeyIndex(static_cast<ImGuiKey>(imgui_key)); }
-	inline bool IsKeyDown(int user_key_index)															{ return ImGui::IsKeyDown((ImGuiKey)user_key_index); }
-	inline bool IsKeyPressed(int user_key_index)														{ return ImGui::IsKeyPressed((ImGuiKey)user_key_index); }
-	inline bool IsKeyPressed(int user_key_index, bool repeat)											{ return ImGui::IsKeyPressed((ImGuiKey)user_key_index, repeat); }
-	inline bool IsKeyReleased(int user_key_index)														{ return ImGui::IsKeyReleased((ImGuiKey)user_key_index); }
-	inline int GetKeyPressedAmount(int key_index, float repeat_delay, float rate)						{ return ImGui::GetKeyPressedAmount((ImGuiKey)key_index, repeat_delay, rate); }
-	inline void SetNextFrameWantCaptureKeyboard(bool want_capture_keyboard_value)						{ ImGui::SetNextFrameWantCaptureKeyboard(want_capture_keyboard_value); }
-
-	// Inputs Utilities: Mouse
-	inline bool IsMouseDown(int button)																	{ return ImGui::IsMouseDown(static_cast<ImGuiMouseButton>(button)); }
-	inline bool IsMouseClicked(int button)																{ return ImGui::IsMouseClicked(static_cast<ImGuiMouseButton>(button)); }
-	inline bool IsMouseClicked(int button, bool repeat)													{ return ImGui::IsMouseClicked(static_cast<ImGuiMouseButton>(button), repeat); }
-	inline bool IsMouseReleased(int button)																{ return ImGui::IsMouseReleased(static_cast<ImGuiMouseButton>(button)); }
-	inline bool IsMouseDoubleClicked(int button)														{ return ImGui::IsMouseDoubleClicked(static_cast<ImGuiMouseButton>(button)); }
-	inline bool IsMouseHoveringRect(float min_x, float min_y, float max_x, float max_y)					{ return ImGui::IsMouseHoveringRect({ min_x, min_y }, { max_x, max_y }); }
-	inline bool IsMouseHoveringRect(float min_x, float min_y, float max_x, float max_y, bool clip)		{ return ImGui::IsMouseHoveringRect({ min_x, min_y }, { max_x, max_y }, clip); }
-	inline bool IsMousePosValid()																		{ return false; /* TODO: IsMousePosValid() ==> UNSUPPORTED */ }
-	inline bool IsAnyMouseDown()																		{ return ImGui::IsAnyMouseDown(); }
-	inline std::tuple<float, float> GetMousePos()														{ const auto vec2{ ImGui::GetMousePos() }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetMousePosOnOpeningCurrentPopup()									{ const auto vec2{ ImGui::GetMousePosOnOpeningCurrentPopup() }; return std::make_tuple(vec2.x, vec2.y); }
-	inline bool IsMouseDragging(int button)																{ return ImGui::IsMouseDragging(static_cast<ImGuiMouseButton>(button)); }
-	inline bool IsMouseDragging(int button, float lock_threshold)										{ return ImGui::IsMouseDragging(static_cast<ImGuiMouseButton>(button), lock_threshold); }
-	inline std::tuple<float, float> GetMouseDragDelta()													{ const auto vec2{ ImGui::GetMouseDragDelta() }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetMouseDragDelta(int button)										{ const auto vec2{ ImGui::GetMouseDragDelta(static_cast<ImGuiMouseButton>(button)) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline std::tuple<float, float> GetMouseDragDelta(int button, float lock_threshold)					{ const auto vec2{ ImGui::GetMouseDragDelta(static_cast<ImGuiMouseButton>(button), lock_threshold) }; return std::make_tuple(vec2.x, vec2.y); }
-	inline void ResetMouseDragDelta()																	{ ImGui::ResetMouseDragDelta(); }
-	inline void ResetMouseDragDelta(int button)															{ ImGui::ResetMouseDragDelta(static_cast<ImGuiMouseButton>(button)); }
-	inline int GetMouseCursor()																			{ return ImGui::GetMouseCursor(); }
-	inline void SetMouseCursor(int cursor_type)															{ ImGui::SetMouseCursor(static_cast<ImGuiMouseCursor>(cursor_type)); }
-	inline void SetNextFrameWantCaptureMouse(bool want_capture_mouse) { ImGui::SetNextFrameWantCaptureMouse(want_capture_mouse); }
-
-	// Clipboard Utilities
-	inline std::string GetClipboardText()																{ return std::string(ImGui::GetClipboardText()); }
-	inline void SetClipboardText(const std::string& text)												{ ImGui::SetClipboardText(text.c_str()); }
-	
 // helper to fill enum values.
 #define ENUM_HELPER(prefix, val) #val , prefix##_##val
 	template <typename SolStateOrView>
-	inline void InitEnums(SolStateOrView& lua)
+	SOL_IMGUI_INIT_INLINE void InitEnums(SolStateOrView& lua)
 	{
 		static_assert( std::is_same_v<SolStateOrView, sol::state> || std::is_same_v<SolStateOrView, sol::state_view>, "sol_ImGui::InitEnums only accepts sol::state& or sol::state_view&");
 #pragma region Window Flags
-		lua.new_enum("ImGuiWindowFlags",
+		detail::RegisterEnum(lua, "ImGuiWindowFlags",
 			ENUM_HELPER(ImGuiWindowFlags, None),
 			ENUM_HELPER(ImGuiWindowFlags, NoTitleBar),
 			ENUM_HELPER(ImGuiWindowFlags, NoResize),
@@ -1788,7 +6907,6 @@ namespace sol_ImGui
 			ENUM_HELPER(ImGuiWindowFlags, NoNavFocus),
 			ENUM_HELPER(ImGuiWindowFlags, UnsavedDocument),
 			#ifndef IMGUI_NO_DOCKING
-			,	// Gotta add the comma for correct syntax
 			ENUM_HELPER(ImGuiWindowFlags, NoDocking),
 			#endif
 			ENUM_HELPER(ImGuiWindowFlags, NoNav),
@@ -1807,7 +6925,7 @@ namespace sol_ImGui
 #pragma endregion Window Flags
 
 #pragma region Child Flags
-		lua.new_enum("ImGuiChildFlags",
+		detail::RegisterEnum(lua, "ImGuiChildFlags",
 			ENUM_HELPER(ImGuiChildFlags, None),
 			ENUM_HELPER(ImGuiChildFlags, Border),
 			ENUM_HELPER(ImGuiChildFlags, AlwaysUseWindowPadding),
@@ -1822,7 +6940,7 @@ namespace sol_ImGui
 #pragma endregion Child Flags
 
 #pragma region Item Flags
-		lua.new_enum("ImGuiItemFlags",
+		detail::RegisterEnum(lua, "ImGuiItemFlags",
 			ENUM_HELPER(ImGuiItemFlags, None),
 			ENUM_HELPER(ImGuiItemFlags, NoTabStop),
 			ENUM_HELPER(ImGuiItemFlags, NoNav),
@@ -1834,7 +6952,7 @@ namespace sol_ImGui
 #pragma endregion Item Flags
 
 #pragma region InputText Flags
-		lua.new_enum("ImGuiInputTextFlags",
+		detail::RegisterEnum(lua, "ImGuiInputTextFlags",
 			ENUM_HELPER(ImGuiInputTextFlags, None),
 			ENUM_HELPER(ImGuiInputTextFlags, CharsDecimal),
 			ENUM_HELPER(ImGuiInputTextFlags, CharsHexadecimal),
@@ -1863,7 +6981,7 @@ namespace sol_ImGui
 #pragma endregion InputText Flags
 
 #pragma region TreeNode Flags
-		lua.new_enum("ImGuiTreeNodeFlags",
+		detail::RegisterEnum(lua, "ImGuiTreeNodeFlags",
 			ENUM_HELPER(ImGuiTreeNodeFlags, None),
 			ENUM_HELPER(ImGuiTreeNodeFlags, Selected),
 			ENUM_HELPER(ImGuiTreeNodeFlags, Framed),
@@ -1887,7 +7005,7 @@ namespace sol_ImGui
 #pragma endregion TreeNode Flags
 
 #pragma region Popup Flags
-		lua.new_enum("ImGuiPopupFlags",
+		detail::RegisterEnum(lua, "ImGuiPopupFlags",
 			ENUM_HELPER(ImGuiPopupFlags,None),
 			ENUM_HELPER(ImGuiPopupFlags,MouseButtonLeft),
 			ENUM_HELPER(ImGuiPopupFlags,MouseButtonRight),
@@ -1904,7 +7022,7 @@ namespace sol_ImGui
 #pragma endregion Popup Flags
 
 #pragma region Selectable Flags
-		lua.new_enum("ImGuiSelectableFlags",
+		detail::RegisterEnum(lua, "ImGuiSelectableFlags",
 			ENUM_HELPER(ImGuiSelectableFlags, None),
 			ENUM_HELPER(ImGuiSelectableFlags, NoAutoClosePopups),
 			ENUM_HELPER(ImGuiSelectableFlags, SpanAllColumns),
@@ -1915,7 +7033,7 @@ namespace sol_ImGui
 #pragma endregion Selectable Flags
 
 #pragma region Combo Flags
-		lua.new_enum("ImGuiComboFlags",
+		detail::RegisterEnum(lua, "ImGuiComboFlags",
 			ENUM_HELPER(ImGuiComboFlags, None),
 			ENUM_HELPER(ImGuiComboFlags, PopupAlignLeft),
 			ENUM_HELPER(ImGuiComboFlags, HeightSmall),
@@ -1930,7 +7048,7 @@ namespace sol_ImGui
 #pragma endregion Combo Flags
 
 #pragma region TabBar Flags
-		lua.new_enum("ImGuiTabBarFlags",
+		detail::RegisterEnum(lua, "ImGuiTabBarFlags",
 			ENUM_HELPER(ImGuiTabBarFlags, None),
 			ENUM_HELPER(ImGuiTabBarFlags, Reorderable),
 			ENUM_HELPER(ImGuiTabBarFlags, AutoSelectNewTabs),
@@ -1947,7 +7065,7 @@ namespace sol_ImGui
 #pragma endregion TabBar Flags
 
 #pragma region TabItem Flags
-		lua.new_enum("ImGuiTabItemFlags",
+		detail::RegisterEnum(lua, "ImGuiTabItemFlags",
 			ENUM_HELPER(ImGuiTabItemFlags, None),
 			ENUM_HELPER(ImGuiTabItemFlags, UnsavedDocument),
 			ENUM_HELPER(ImGuiTabItemFlags, SetSelected),
@@ -1962,7 +7080,7 @@ namespace sol_ImGui
 #pragma endregion TabItem Flags
 
 #pragma region Focused Flags
-		lua.new_enum("ImGuiFocusedFlags",
+		detail::RegisterEnum(lua, "ImGuiFocusedFlags",
 			ENUM_HELPER(ImGuiFocusedFlags, None),
 			ENUM_HELPER(ImGuiFocusedFlags, ChildWindows),
 			ENUM_HELPER(ImGuiFocusedFlags, RootWindow),
@@ -1976,7 +7094,7 @@ namespace sol_ImGui
 #pragma endregion Focused Flags
 
 #pragma region Hovered Flags
-		lua.new_enum("ImGuiHoveredFlags",
+		detail::RegisterEnum(lua, "ImGuiHoveredFlags",
 			ENUM_HELPER(ImGuiHoveredFlags, None),
 			ENUM_HELPER(ImGuiHoveredFlags, ChildWindows),
 			ENUM_HELPER(ImGuiHoveredFlags, RootWindow),
@@ -2004,8 +7122,8 @@ namespace sol_ImGui
 #pragma endregion Hovered Flags
 
 #pragma region DockNode Flags
-#ifndef IMGUI_NO_DOCKING
-		lua.new_enum("ImGuiDockNodeFlags",
+#if !defined(IMGUI_NO_DOCKING) && SOL_IMGUI_MODULE_DOCKING
+		detail::RegisterEnum(lua, "ImGuiDockNodeFlags",
 			ENUM_HELPER(ImGuiDockNodeFlags, None),
 			ENUM_HELPER(ImGuiDockNodeFlags, KeepAliveOnly),
 			ENUM_HELPER(ImGuiDockNodeFlags, NoDockingOverCentralNode),
@@ -2019,7 +7137,7 @@ namespace sol_ImGui
 #pragma endregion DockNode Flags
 
 #pragma region DragDrop Flags
-		lua.new_enum("ImGuiDragDropFlags",
+		detail::RegisterEnum(lua, "ImGuiDragDropFlags",
 			ENUM_HELPER(ImGuiDragDropFlags, None),
 			ENUM_HELPER(ImGuiDragDropFlags, SourceNoPreviewTooltip),
 			ENUM_HELPER(ImGuiDragDropFlags, SourceNoDisableHover),
@@ -2037,7 +7155,7 @@ namespace sol_ImGui
 #pragma endregion DragDrop Flags
 
 #pragma region Datatype
-		lua.new_enum("ImGuiDataType",
+		detail::RegisterEnum(lua, "ImGuiDataType",
 			ENUM_HELPER(ImGuiDataType, S8),
 			ENUM_HELPER(ImGuiDataType, U8),
 			ENUM_HELPER(ImGuiDataType, S16),
@@ -2054,7 +7172,7 @@ namespace sol_ImGui
 #pragma endregion Datatype
 
 #pragma region Dir
-		lua.new_enum("ImGuiDir",
+		detail::RegisterEnum(lua, "ImGuiDir",
 			ENUM_HELPER(ImGuiDir,None),
 			ENUM_HELPER(ImGuiDir,Left),
 			ENUM_HELPER(ImGuiDir,Right),
@@ -2065,7 +7183,7 @@ namespace sol_ImGui
 #pragma endregion Dir
 
 #pragma region Sort Dir
-		lua.new_enum("ImGuiSortDirection",
+		detail::RegisterEnum(lua, "ImGuiSortDirection",
 			ENUM_HELPER(ImGuiSortDirection, None),
 			ENUM_HELPER(ImGuiSortDirection, Ascending),
 			ENUM_HELPER(ImGuiSortDirection, Descending)
@@ -2073,7 +7191,7 @@ namespace sol_ImGui
 #pragma endregion Sort Dir
 
 #pragma region Key
-		lua.new_enum("ImGuiKey",
+		detail::RegisterEnum(lua, "ImGuiKey",
 			ENUM_HELPER(ImGuiKey, Tab),
 			ENUM_HELPER(ImGuiKey, LeftArrow),
 			ENUM_HELPER(ImGuiKey, RightArrow),
@@ -2249,7 +7367,7 @@ namespace sol_ImGui
 #pragma endregion Key
 
 #pragma region Input Flags
-		lua.new_enum("ImGuiInputFlags",
+		detail::RegisterEnum(lua, "ImGuiInputFlags",
 			ENUM_HELPER(ImGuiInputFlags, None),
 			ENUM_HELPER(ImGuiInputFlags, Repeat),
 			ENUM_HELPER(ImGuiInputFlags, RouteActive),
@@ -2265,7 +7383,7 @@ namespace sol_ImGui
 #pragma endregion Input Flags
 
 #pragma region Config Flags
-		lua.new_enum("ImGuiConfigFlags",
+		detail::RegisterEnum(lua, "ImGuiConfigFlags",
 			ENUM_HELPER(ImGuiConfigFlags, None),
 			ENUM_HELPER(ImGuiConfigFlags, NavEnableKeyboard),
 			ENUM_HELPER(ImGuiConfigFlags, NavEnableGamepad),
@@ -2286,7 +7404,7 @@ namespace sol_ImGui
 #pragma endregion Config Flags
 
 #pragma region Backend Flags
-		lua.new_enum("ImGuiBackendFlags",
+		detail::RegisterEnum(lua, "ImGuiBackendFlags",
 			ENUM_HELPER(ImGuiBackendFlags, None),
 			ENUM_HELPER(ImGuiBackendFlags, HasGamepad),
 			ENUM_HELPER(ImGuiBackendFlags, HasMouseCursors),
@@ -2302,7 +7420,7 @@ namespace sol_ImGui
 #pragma endregion Backend Flags
 
 #pragma region Col
-		lua.new_enum("ImGuiCol",
+		detail::RegisterEnum(lua, "ImGuiCol",
 			ENUM_HELPER(ImGuiCol, Text),
 			ENUM_HELPER(ImGuiCol, TextDisabled),
 			ENUM_HELPER(ImGuiCol, WindowBg),
@@ -2368,7 +7486,7 @@ namespace sol_ImGui
 #pragma endregion Col
 
 #pragma region Style
-		lua.new_enum("ImGuiStyleVar",
+		detail::RegisterEnum(lua, "ImGuiStyleVar",
 			ENUM_HELPER(ImGuiStyleVar, Alpha),
 			ENUM_HELPER(ImGuiStyleVar, DisabledAlpha),
 			ENUM_HELPER(ImGuiStyleVar, WindowPadding),
@@ -2410,7 +7528,7 @@ namespace sol_ImGui
 #pragma endregion Style
 
 #pragma region Button Flags
-		lua.new_enum("ImGuiButtonFlags",
+		detail::RegisterEnum(lua, "ImGuiButtonFlags",
 			ENUM_HELPER(ImGuiButtonFlags, None),
 			ENUM_HELPER(ImGuiButtonFlags, MouseButtonLeft),
 			ENUM_HELPER(ImGuiButtonFlags, MouseButtonRight),
@@ -2420,7 +7538,7 @@ namespace sol_ImGui
 #pragma endregion Button Flags
 
 #pragma region ColorEdit Flags
-		lua.new_enum("ImGuiColorEditFlags",
+		detail::RegisterEnum(lua, "ImGuiColorEditFlags",
 			ENUM_HELPER(ImGuiColorEditFlags, None),
 			ENUM_HELPER(ImGuiColorEditFlags, NoAlpha),
 			ENUM_HELPER(ImGuiColorEditFlags, NoPicker),
@@ -2454,7 +7572,7 @@ namespace sol_ImGui
 #pragma endregion ColorEdit Flags
 
 #pragma region Slider Flags
-		lua.new_enum("ImGuiSliderFlags",
+		detail::RegisterEnum(lua, "ImGuiSliderFlags",
 			ENUM_HELPER(ImGuiSliderFlags, None),
 			ENUM_HELPER(ImGuiSliderFlags, AlwaysClamp),
 			ENUM_HELPER(ImGuiSliderFlags, Logarithmic),
@@ -2465,8 +7583,23 @@ namespace sol_ImGui
 		);
 #pragma endregion Slider Flags
 
+#pragma region Data Type
+		detail::RegisterEnum(lua, "ImGuiDataType",
+			ENUM_HELPER(ImGuiDataType, S8),
+			ENUM_HELPER(ImGuiDataType, U8),
+			ENUM_HELPER(ImGuiDataType, S16),
+			ENUM_HELPER(ImGuiDataType, U16),
+			ENUM_HELPER(ImGuiDataType, S32),
+			ENUM_HELPER(ImGuiDataType, U32),
+			ENUM_HELPER(ImGuiDataType, S64),
+			ENUM_HELPER(ImGuiDataType, U64),
+			ENUM_HELPER(ImGuiDataType, Float),
+			ENUM_HELPER(ImGuiDataType, Double)
+		);
+#pragma endregion Data Type
+
 #pragma region MouseButton
-		lua.new_enum("ImGuiMouseButton",
+		detail::RegisterEnum(lua, "ImGuiMouseButton",
 			ENUM_HELPER(ImGuiMouseButton, Left),
 			ENUM_HELPER(ImGuiMouseButton, Right),
 			ENUM_HELPER(ImGuiMouseButton, Middle),
@@ -2475,7 +7608,7 @@ namespace sol_ImGui
 #pragma endregion MouseButton
 
 #pragma region MouseCursor
-		lua.new_enum("ImGuiMouseCursor",
+		detail::RegisterEnum(lua, "ImGuiMouseCursor",
 			ENUM_HELPER(ImGuiMouseCursor, None),
 			ENUM_HELPER(ImGuiMouseCursor, Arrow),
 			ENUM_HELPER(ImGuiMouseCursor, TextInput),
@@ -2491,7 +7624,7 @@ namespace sol_ImGui
 #pragma endregion MouseCursor
 
 #pragma region Mouse Source
-			lua.new_enum("ImGuiMouseSource",
+			detail::RegisterEnum(lua, "ImGuiMouseSource",
 				ENUM_HELPER(ImGuiMouseSource, Mouse),
 				ENUM_HELPER(ImGuiMouseSource, TouchScreen),
 				ENUM_HELPER(ImGuiMouseSource, Pen),
@@ -2500,7 +7633,7 @@ namespace sol_ImGui
 #pragma endregion Sort Dir
 
 #pragma region Cond
-		lua.new_enum("ImGuiCond",
+		detail::RegisterEnum(lua, "ImGuiCond",
 			ENUM_HELPER(ImGuiCond, None),
 			ENUM_HELPER(ImGuiCond, Always),
 			ENUM_HELPER(ImGuiCond, Once),
@@ -2509,10 +7642,25 @@ namespace sol_ImGui
 		);
 #pragma endregion Cond
 
+#pragma region Flag Presets
+		// Common flag combinations, so scripts don't have to OR them together every frame
+		detail::RegisterEnum(lua, "ImGuiFlagPresets",
+			"WindowOverlay",		ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav,
+			"WindowHud",			ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoBackground | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav,
+			"WindowFixed",			ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoSavedSettings,
+			"WindowFullscreen",		ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoBringToFrontOnFocus,
+			"ChildPanel",			ImGuiChildFlags_Border | ImGuiChildFlags_AlwaysUseWindowPadding,
+			"TreeNodeLeaf",			ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen,
+			"TreeNodeSelectable",	ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth,
+			"InputTextSubmit",		ImGuiInputTextFlags_EnterReturnsTrue | ImGuiInputTextFlags_AutoSelectAll,
+			"InputTextNumeric",		ImGuiInputTextFlags_CharsDecimal | ImGuiInputTextFlags_AutoSelectAll
+		);
+#pragma endregion Flag Presets
+
 	}
 	
 	template <typename SolStateOrView>
-	inline void InitUserTypes(SolStateOrView& lua)
+	SOL_IMGUI_INIT_INLINE void InitUserTypes(SolStateOrView& lua)
 	{
 		static_assert( std::is_same_v<SolStateOrView, sol::state> || std::is_same_v<SolStateOrView, sol::state_view>, "sol_ImGui::InitUserTypes only accepts sol::state& or sol::state_view&");
 		
@@ -2530,6 +7678,58 @@ namespace sol_ImGui
 			"w", &ImVec4::w
 		);
 
+	#ifdef SOL_IMGUI_ENABLE_MESSAGE_QUEUE
+		lua.new_usertype<MessageQueue>("ImGuiMessageQueue",
+			sol::no_constructor, // Owned by the host, which hands a pointer to Lua
+			"Drain",					&MessageQueue::Drain,
+			"DrainInto",				&MessageQueue::DrainInto,
+			"GetDroppedCount",			&MessageQueue::GetDroppedCount
+		);
+	#endif
+
+	#ifdef SOL_IMGUI_ENABLE_RETAINED
+		using RetainedBinding = int(RetainedWindow::*)(const std::string&, sol::table, sol::object, sol::optional<sol::protected_function>);
+		using RetainedRange = int(RetainedWindow::*)(const std::string&, sol::table, sol::object, float, float, sol::optional<sol::protected_function>);
+		lua.new_usertype<RetainedWindow>("ImGuiRetainedWindow",
+			sol::no_constructor, // Created with ImGui.CreateRetainedWindow, shared by the RetainedUI and Lua
+			"Text",						&RetainedWindow::Text,
+			"Separator",				&RetainedWindow::Separator,
+			"SameLine",					&RetainedWindow::SameLine,
+			"Button",					&RetainedWindow::Button,
+			"Checkbox",					static_cast<RetainedBinding>(&RetainedWindow::Checkbox),
+			"SliderFloat",				static_cast<RetainedRange>(&RetainedWindow::SliderFloat),
+			"SliderInt",				static_cast<int(RetainedWindow::*)(const std::string&, sol::table, sol::object, int, int, sol::optional<sol::protected_function>)>(&RetainedWindow::SliderInt),
+			"DragFloat",				static_cast<int(RetainedWindow::*)(const std::string&, sol::table, sol::object, float, float, float, sol::optional<sol::protected_function>)>(&RetainedWindow::DragFloat),
+			"InputText",				static_cast<RetainedBinding>(&RetainedWindow::InputText),
+			"TreeNode",					&RetainedWindow::TreeNode,
+			"TreePop",					&RetainedWindow::TreePop,
+			"SetLabel",					&RetainedWindow::SetLabel,
+			"Refresh",					&RetainedWindow::Refresh,
+			"Clear",					&RetainedWindow::Clear,
+			"SetVisible",				&RetainedWindow::SetVisible,
+			"IsVisible",				&RetainedWindow::IsVisible
+		);
+	#endif
+
+	#ifdef SOL_IMGUI_ENABLE_PROPERTY_GRID
+		lua.new_usertype<PropertySpecs>("ImGuiPropertySpecs",
+			sol::no_constructor, // Created with ImGui.CreatePropertySpecs, which validates the specs
+			"GetCount",					&PropertySpecs::GetCount
+		);
+	#endif
+
+	#if SOL_IMGUI_MODULE_WIDGETS
+		lua.new_usertype<ScalarBuffer>("ImGuiScalarBuffer",
+			sol::constructors<ScalarBuffer(ImGuiDataType, int)>(), // Hosts hand views over their own memory to Lua instead
+			"Get",						&ScalarBuffer::Get,
+			"Set",						&ScalarBuffer::Set,
+			"GetType",					&ScalarBuffer::GetType,
+			"GetCount",					&ScalarBuffer::GetCount,
+			"GetStride",				&ScalarBuffer::GetStride
+		);
+	#endif
+
+	#if SOL_IMGUI_MODULE_DRAWLIST
 		lua.new_usertype<ImDrawList>("ImDrawList",
 			sol::no_constructor, // Prevent creating ImDrawList directly in Lua
 
@@ -2570,19 +7770,29 @@ namespace sol_ImGui
 			"AddImageQuad", 			&ImDrawList::AddImageQuad,
 			"AddImageRounded", 			&ImDrawList::AddImageRounded
 		);
+	#endif
 	}
 
 	template <typename SolStateOrView>
-	inline void Init(SolStateOrView& lua)
+	SOL_IMGUI_INIT_INLINE void Init(SolStateOrView& lua)
 	{
 		static_assert( std::is_same_v<SolStateOrView, sol::state> || std::is_same_v<SolStateOrView, sol::state_view>, "sol_ImGui::Init only accepts sol::state& or sol::state_view&");
+	#if SOL_IMGUI_MODULE_ENUMS
 		InitEnums(lua);
+	#endif
 		
 		InitUserTypes(lua);
 
+	#if defined(SOL_IMGUI_LAZY_BINDINGS)
+		detail::LazyBindingTable ImGui{ lua.create_named_table("ImGui") };
+	#elif defined(SOL_IMGUI_LEAN_BINDINGS)
+		detail::LeanBindingTable ImGui{ lua.create_named_table("ImGui") };
+	#else
 		sol::table ImGui = lua.create_named_table("ImGui");
+	#endif
 
 
+#if SOL_IMGUI_MODULE_WINDOWS
 #pragma region Windows
 		ImGui.set_function("Begin"							, sol::overload(
 																sol::resolve<bool(const std::string&)>(Begin),
@@ -2665,7 +7875,9 @@ namespace sol_ImGui
 																sol::resolve<void(const std::string&)>(SetWindowFocus)
 															));
 		ImGui.set_function("SetWindowFontScale"				, SetWindowFontScale);
+	#if SOL_IMGUI_MODULE_DRAWLIST
 		ImGui.set_function("GetWindowDrawList"				, GetWindowDrawList);
+	#endif
 #pragma endregion Window Utilities
 		
 #pragma region Content Region
@@ -2700,7 +7912,9 @@ namespace sol_ImGui
 																sol::resolve<void(float, float)>(SetScrollFromPosY)
 															));
 #pragma endregion Windows Scrolling
+#endif
 		
+#if SOL_IMGUI_MODULE_LAYOUT
 #pragma region Parameters stacks (shared)
 		ImGui.set_function("PushFont"						, PushFont);
 		ImGui.set_function("PopFont"						, PopFont);
@@ -2758,6 +7972,7 @@ namespace sol_ImGui
 															));
 		ImGui.set_function("BeginGroup"						, BeginGroup);
 		ImGui.set_function("EndGroup"						, EndGroup);
+		ImGui.set_function("LazyRegion"						, LazyRegion);
 		ImGui.set_function("GetCursorPos"					, GetCursorPos);
 		ImGui.set_function("GetCursorPosX"					, GetCursorPosX);
 		ImGui.set_function("GetCursorPosY"					, GetCursorPosY);
@@ -2786,7 +8001,9 @@ namespace sol_ImGui
 																sol::resolve<int(const std::string&, const std::string&)>(GetID)
 															));
 #pragma endregion ID stack / scopes
+#endif
 		
+#if SOL_IMGUI_MODULE_WIDGETS
 #pragma region Widgets: Text
 		ImGui.set_function("TextUnformatted"				, sol::overload(
 																sol::resolve<void(const std::string&)>(TextUnformatted), 
@@ -2904,6 +8121,22 @@ namespace sol_ImGui
 																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int, const std::string&)>(DragInt4),
 																sol::resolve<std::tuple<sol::as_table_t<std::vector<int>>, bool>(const std::string&, const sol::table&, float, int, int, const std::string&, int)>(DragInt4)
 															));
+		ImGui.set_function("DragScalar"						, sol::overload(
+																sol::resolve<bool(const std::string&, ScalarBuffer&)>(DragScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int)>(DragScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, float)>(DragScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, float, lua_Number, lua_Number)>(DragScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, float, lua_Number, lua_Number, const std::string&)>(DragScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, float, lua_Number, lua_Number, const std::string&, int)>(DragScalar)
+															));
+		ImGui.set_function("DragScalarN"					, sol::overload(
+																sol::resolve<bool(const std::string&, ScalarBuffer&)>(DragScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int)>(DragScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, float)>(DragScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, float, lua_Number, lua_Number)>(DragScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, float, lua_Number, lua_Number, const std::string&)>(DragScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, float, lua_Number, lua_Number, const std::string&, int)>(DragScalarN)
+															));
 #pragma endregion Widgets: Drags
 
 #pragma region Widgets: Sliders
@@ -2963,6 +8196,21 @@ namespace sol_ImGui
 																sol::resolve<std::tuple<int, bool>(const std::string&, float, float, int, int, int, const std::string&)>(VSliderInt),
 																sol::resolve<std::tuple<int, bool>(const std::string&, float, float, int, int, int, const std::string&, int)>(VSliderInt)
 															));
+		ImGui.set_function("SliderScalar"					, sol::overload(
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number, lua_Number)>(SliderScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number, lua_Number, const std::string&)>(SliderScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number, lua_Number, const std::string&, int)>(SliderScalar)
+															));
+		ImGui.set_function("SliderScalarN"					, sol::overload(
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number, lua_Number)>(SliderScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number, lua_Number, const std::string&)>(SliderScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number, lua_Number, const std::string&, int)>(SliderScalarN)
+															));
+		ImGui.set_function("VSliderScalar"					, sol::overload(
+																sol::resolve<bool(const std::string&, float, float, ScalarBuffer&, int, lua_Number, lua_Number)>(VSliderScalar),
+																sol::resolve<bool(const std::string&, float, float, ScalarBuffer&, int, lua_Number, lua_Number, const std::string&)>(VSliderScalar),
+																sol::resolve<bool(const std::string&, float, float, ScalarBuffer&, int, lua_Number, lua_Number, const std::string&, int)>(VSliderScalar)
+															));
 #pragma endregion Widgets: Sliders
 
 #pragma region Widgets: Inputs using Keyboard
@@ -3027,6 +8275,22 @@ namespace sol_ImGui
 																sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double, const std::string&)>(InputDouble),
 																sol::resolve<std::tuple<double, bool>(const std::string&, double, double, double, const std::string&, int)>(InputDouble)
 															));
+		ImGui.set_function("InputScalar"					, sol::overload(
+																sol::resolve<bool(const std::string&, ScalarBuffer&)>(InputScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int)>(InputScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number)>(InputScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number, lua_Number)>(InputScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number, lua_Number, const std::string&)>(InputScalar),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, lua_Number, lua_Number, const std::string&, int)>(InputScalar)
+															));
+		ImGui.set_function("InputScalarN"					, sol::overload(
+																sol::resolve<bool(const std::string&, ScalarBuffer&)>(InputScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int)>(InputScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number)>(InputScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number, lua_Number)>(InputScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number, lua_Number, const std::string&)>(InputScalarN),
+																sol::resolve<bool(const std::string&, ScalarBuffer&, int, int, lua_Number, lua_Number, const std::string&, int)>(InputScalarN)
+															));
 #pragma endregion Widgets: Inputs using Keyboard
 
 #pragma region Widgets: Color Editor / Picker
@@ -3103,7 +8367,9 @@ namespace sol_ImGui
 																sol::resolve<void(const std::string&, float, const std::string&)>(Value)
 															));
 #pragma endregion Widgets: Value() Helpers
+#endif
 
+#if SOL_IMGUI_MODULE_POPUPS
 #pragma region Widgets: Menu
 		ImGui.set_function("BeginMenuBar"					, BeginMenuBar);
 		ImGui.set_function("EndMenuBar"						, EndMenuBar);
@@ -3164,7 +8430,9 @@ namespace sol_ImGui
 																sol::resolve<bool(const std::string&, int)>(IsPopupOpen)
 															));
 #pragma endregion Popups, Modals
+#endif
 
+#if SOL_IMGUI_MODULE_LAYOUT
 #pragma region Columns
 		ImGui.set_function("Columns"						, sol::overload(
 																sol::resolve<void()>(Columns),
@@ -3186,7 +8454,9 @@ namespace sol_ImGui
 		ImGui.set_function("SetColumnOffset"				, SetColumnOffset);
 		ImGui.set_function("GetColumnsCount"				, GetColumnsCount);
 #pragma endregion Columns
+#endif
 
+#if SOL_IMGUI_MODULE_TABS
 #pragma region Tab Bars, Tabs
 		ImGui.set_function("BeginTabBar"					, sol::overload(
 																sol::resolve<bool(const std::string&)>(BeginTabBar),
@@ -3201,9 +8471,10 @@ namespace sol_ImGui
 		ImGui.set_function("EndTabItem"						, EndTabItem);
 		ImGui.set_function("SetTabItemClosed"				, SetTabItemClosed);
 #pragma endregion Tab Bars, Tabs
+#endif
 
 #pragma region Docking
-#ifndef IMGUI_NO_DOCKING	// Define IMGUI_NO_DOCKING to disable these for compatibility with ImGui's master branch
+#if !defined(IMGUI_NO_DOCKING) && SOL_IMGUI_MODULE_DOCKING	// Define IMGUI_NO_DOCKING to disable these for compatibility with ImGui's master branch
 		ImGui.set_function("DockSpace"						, sol::overload(
 																sol::resolve<void(unsigned int)>(DockSpace),
 																sol::resolve<void(unsigned int, float, float)>(DockSpace),
@@ -3218,6 +8489,7 @@ namespace sol_ImGui
 #endif
 #pragma endregion Docking
 
+#if SOL_IMGUI_MODULE_UTILITIES
 #pragma region Logging / Capture
 		ImGui.set_function("LogToTTY"						, sol::overload(
 																sol::resolve<void()>(LogToTTY),
@@ -3357,9 +8629,247 @@ namespace sol_ImGui
 		ImGui.set_function("GetClipboardText"				, GetClipboardText);
 		ImGui.set_function("SetClipboardText"				, SetClipboardText);
 #pragma endregion Clipboard Utilities
+#endif
+
+#pragma region GC Scheduler
+#ifdef SOL_IMGUI_ENABLE_GC_SCHEDULER
+		ImGui.set_function("GetGCStats"						, GetGCStats);
+		ImGui.set_function("SetGCBudget"					, SetGCBudget);
+#endif
+#pragma endregion GC Scheduler
+
+#pragma region Task Scheduler
+#ifdef SOL_IMGUI_ENABLE_TASK_SCHEDULER
+		ImGui.set_function("StartTask"						, StartTask);
+		ImGui.set_function("CancelTask"						, CancelTask);
+		ImGui.set_function("GetTaskStatus"					, GetTaskStatus);
+		ImGui.set_function("GetTaskStats"					, GetTaskStats);
+		ImGui.set_function("ShouldYield"					, ShouldYield);
+#endif
+#pragma endregion Task Scheduler
+
+#pragma region Retained Widgets
+#ifdef SOL_IMGUI_ENABLE_RETAINED
+		ImGui.set_function("CreateRetainedWindow"			, CreateRetainedWindow);
+		ImGui.set_function("DestroyRetainedWindow"			, DestroyRetainedWindow);
+#endif
+#pragma endregion Retained Widgets
+
+#pragma region Property Grid
+#ifdef SOL_IMGUI_ENABLE_PROPERTY_GRID
+		ImGui.set_function("CreatePropertySpecs"			, CreatePropertySpecs);
+		ImGui.set_function("PropertyGrid"					, PropertyGrid);
+#endif
+#pragma endregion Property Grid
+
+#pragma region Reflection Inspector
+#ifdef SOL_IMGUI_ENABLE_INSPECTOR
+		ImGui.set_function("Inspect"						, Inspect);
+#endif
+#pragma endregion Reflection Inspector
+
+#pragma region Allocation Tracking
+#ifdef SOL_IMGUI_ENABLE_ALLOC_TRACKING
+		ImGui.set_function("GetAllocStats"					, GetAllocStats);
+#endif
+#pragma endregion Allocation Tracking
+
+#pragma region Scope Timing
+#ifdef SOL_IMGUI_ENABLE_SCOPE_TIMING
+		ImGui.set_function("BeginTimingScope"				, BeginTimingScope);
+		ImGui.set_function("EndTimingScope"					, EndTimingScope);
+		ImGui.set_function("GetScopeTimings"				, GetScopeTimingsTable);
+		ImGui.set_function("ShowScopeTimingsWindow"			, sol::overload(
+																sol::resolve<void()>(ShowScopeTimingsWindow),
+																sol::resolve<bool(bool)>(ShowScopeTimingsWindow)
+															));
+#endif
+#pragma endregion Scope Timing
+
+#pragma region Binding Statistics
+#ifdef SOL_IMGUI_ENABLE_BINDING_STATS
+		ImGui.set_function("GetBindingStats"				, GetBindingStatsTable);
+#endif
+#pragma endregion Binding Statistics
+
+#pragma region Sampling Profiler
+#ifdef SOL_IMGUI_ENABLE_SAMPLING_PROFILER
+		ImGui.set_function("ShowFlameGraphWindow"			, sol::overload(
+																sol::resolve<void(sol::this_state)>(ShowFlameGraphWindow),
+																sol::resolve<bool(sol::this_state, bool)>(ShowFlameGraphWindow)
+															));
+#endif
+#pragma endregion Sampling Profiler
+
+#pragma region Trace Zones
+#ifdef SOL_IMGUI_ENABLE_TRACE_ZONES
+		ImGui.set_function("ProfileZoneBegin"				, ProfileZoneBegin);
+		ImGui.set_function("ProfileZoneEnd"					, ProfileZoneEnd);
+#endif
+#pragma endregion Trace Zones
+
+#pragma region Draw Cost
+#ifdef SOL_IMGUI_ENABLE_DRAW_COST
+		ImGui.set_function("GetDrawStats"					, GetDrawStats);
+		ImGui.set_function("SetDrawBudget"					, sol::resolve<void(const std::string&, int, int, int)>(SetDrawBudget));
+#endif
+#pragma endregion Draw Cost
+
+#pragma region Window Cache
+#ifdef SOL_IMGUI_ENABLE_WINDOW_CACHE
+		ImGui.set_function("SetNextWindowRefreshInterval"	, SetNextWindowRefreshInterval);
+		ImGui.set_function("InvalidateWindow"				, InvalidateWindow);
+#endif
+#pragma endregion Window Cache
+
+#pragma region LuaJIT FFI
+#ifdef SOL_IMGUI_ENABLE_FFI
+		ImGui.set_function("GetFFIDeclarations"				, GetFFIDeclarations);
+#endif
+#pragma endregion LuaJIT FFI
+
+#pragma region Lazy Registration
+#ifdef SOL_IMGUI_LAZY_BINDINGS
+		ImGui.Install();
+#endif
+#pragma endregion Lazy Registration
+
+#pragma region Unchecked Bindings
+#ifdef SOL_IMGUI_UNCHECKED
+		detail::RegisterUncheckedBindings(ImGui);
+#endif
+#pragma endregion Unchecked Bindings
+
+#pragma region Instrumentation
+#ifdef SOL_IMGUI_INSTRUMENT_BINDINGS	// Must stay last so every binding registered above gets wrapped
+		detail::InstrumentBindings(ImGui);
+#endif
+#pragma endregion Instrumentation
+
+#pragma region Task Yield
+#ifdef SOL_IMGUI_ENABLE_TASK_SCHEDULER	// After the instrumentation: a coroutine cannot yield across the lua_pcall of its wrapper
+		static_cast<sol::table&>(ImGui)["Yield"] = lua["coroutine"]["yield"];
+#endif
+#pragma endregion Task Yield
+	}
+#else
+	// With SOL_IMGUI_COMPILED these are defined and instantiated for sol::state and sol::state_view in sol_ImGui.cpp
+	template <typename SolStateOrView> void InitEnums(SolStateOrView& lua);
+	template <typename SolStateOrView> void InitUserTypes(SolStateOrView& lua);
+	template <typename SolStateOrView> void Init(SolStateOrView& lua);
+#endif
+}
+
+#pragma region LuaJIT FFI
+#ifdef SOL_IMGUI_ENABLE_FFI
+#ifdef _WIN32
+	#define SOL_IMGUI_FFI_EXPORT __declspec(dllexport)
+#else
+	#define SOL_IMGUI_FFI_EXPORT __attribute__((visibility("default")))
+#endif
+
+extern "C"
+{
+#define SOL_IMGUI_FFI_DECLARE(ret, name, params) SOL_IMGUI_FFI_EXPORT ret sol_ImGui_##name params;
+	SOL_IMGUI_FFI_FUNCTIONS(SOL_IMGUI_FFI_DECLARE)
+#undef SOL_IMGUI_FFI_DECLARE
+
+#ifdef SOL_IMGUI_IMPLEMENTATION	// Defined in exactly one translation unit, as sol_ImGui.cpp does, so the symbols exist once
+	// Windows
+	bool sol_ImGui_Begin(const char* name, bool* open, int flags)
+	{
+		if (open && !*open) return false;
+		sol_ImGui::detail::OnWindowBegin(name);
+		SOL_IMGUI_STACK_PUSH(Window);
+		return sol_ImGui::detail::OnWindowOpened(name, ImGui::Begin(name, open, static_cast<ImGuiWindowFlags>(flags)));
 	}
+	void sol_ImGui_End(void)																			{ SOL_IMGUI_STACK_POP(Window, 1); sol_ImGui::detail::OnWindowClosing(); ImGui::End(); sol_ImGui::detail::OnWindowEnd(); }
+	bool sol_ImGui_BeginChild(const char* name, float sizeX, float sizeY, int childFlags, int flags)	{ sol_ImGui::detail::OnWindowBegin(name); SOL_IMGUI_STACK_PUSH(Child); return sol_ImGui::detail::OnWindowOpened(name, ImGui::BeginChild(name, { sizeX, sizeY }, static_cast<ImGuiChildFlags>(childFlags), static_cast<ImGuiWindowFlags>(flags))); }
+	void sol_ImGui_EndChild(void)																		{ SOL_IMGUI_STACK_POP(Child, 1); sol_ImGui::detail::OnWindowClosing(); ImGui::EndChild(); sol_ImGui::detail::OnWindowEnd(); }
+
+	// Layout
+	void sol_ImGui_SameLine(float offsetFromStartX, float spacing)										{ ImGui::SameLine(offsetFromStartX, spacing); }
+	void sol_ImGui_Separator(void)																		{ ImGui::Separator(); }
+	void sol_ImGui_Spacing(void)																		{ ImGui::Spacing(); }
+	void sol_ImGui_NewLine(void)																		{ ImGui::NewLine(); }
+	void sol_ImGui_Dummy(float sizeX, float sizeY)														{ ImGui::Dummy({ sizeX, sizeY }); }
+	void sol_ImGui_Indent(float indentW)																{ ImGui::Indent(indentW); }
+	void sol_ImGui_Unindent(float indentW)																{ ImGui::Unindent(indentW); }
+	void sol_ImGui_SetNextItemWidth(float itemWidth)													{ ImGui::SetNextItemWidth(itemWidth); }
+	void sol_ImGui_PushItemWidth(float itemWidth)														{ ImGui::PushItemWidth(itemWidth); SOL_IMGUI_STACK_PUSH(ItemWidth); }
+	void sol_ImGui_PopItemWidth(void)																	{ SOL_IMGUI_STACK_POP(ItemWidth, 1); ImGui::PopItemWidth(); }
+	void sol_ImGui_PushID(const char* stringID)															{ ImGui::PushID(stringID); SOL_IMGUI_STACK_PUSH(ID); }
+	void sol_ImGui_PushIDInt(int intID)																	{ ImGui::PushID(intID); SOL_IMGUI_STACK_PUSH(ID); }
+	void sol_ImGui_PopID(void)																			{ SOL_IMGUI_STACK_POP(ID, 1); ImGui::PopID(); }
+	void sol_ImGui_PushStyleColor(int idx, float colR, float colG, float colB, float colA)				{ ImGui::PushStyleColor(static_cast<ImGuiCol>(idx), { colR, colG, colB, colA }); SOL_IMGUI_STACK_PUSH(StyleColor); }
+	void sol_ImGui_PopStyleColor(int count)																{ SOL_IMGUI_STACK_POP(StyleColor, count); ImGui::PopStyleColor(count); }
+	void sol_ImGui_PushStyleVar(int idx, float val)														{ ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), val); SOL_IMGUI_STACK_PUSH(StyleVar); }
+	void sol_ImGui_PushStyleVar2(int idx, float valX, float valY)										{ ImGui::PushStyleVar(static_cast<ImGuiStyleVar>(idx), { valX, valY }); SOL_IMGUI_STACK_PUSH(StyleVar); }
+	void sol_ImGui_PopStyleVar(int count)																{ SOL_IMGUI_STACK_POP(StyleVar, count); ImGui::PopStyleVar(count); }
+
+	// Widgets
+	void sol_ImGui_Text(const char* text)																{ ImGui::Text(text); }
+	void sol_ImGui_TextColored(float colR, float colG, float colB, float colA, const char* text)		{ ImGui::TextColored({ colR, colG, colB, colA }, text); }
+	void sol_ImGui_TextDisabled(const char* text)														{ ImGui::TextDisabled(text); }
+	void sol_ImGui_TextWrapped(const char* text)														{ ImGui::TextWrapped(text); }
+	void sol_ImGui_LabelText(const char* label, const char* text)										{ ImGui::LabelText(label, text); }
+	void sol_ImGui_BulletText(const char* text)															{ ImGui::BulletText(text); }
+	bool sol_ImGui_Button(const char* label, float sizeX, float sizeY)									{ return ImGui::Button(label, { sizeX, sizeY }); }
+	bool sol_ImGui_SmallButton(const char* label)														{ return ImGui::SmallButton(label); }
+	bool sol_ImGui_Checkbox(const char* label, bool* v)													{ return ImGui::Checkbox(label, v); }
+	void sol_ImGui_ProgressBar(float fraction, float sizeX, float sizeY, const char* overlay)			{ ImGui::ProgressBar(fraction, { sizeX, sizeY }, overlay); }
+	bool sol_ImGui_Selectable(const char* label, bool selected, int flags, float sizeX, float sizeY)	{ ImGui::Selectable(label, &selected, static_cast<ImGuiSelectableFlags>(flags), { sizeX, sizeY }); return selected; }
+	bool sol_ImGui_TreeNode(const char* label)															{ return SOL_IMGUI_STACK_PUSH_IF(ImGui::TreeNode(label), Tree); }
+	void sol_ImGui_TreePop(void)																		{ SOL_IMGUI_STACK_POP(Tree, 1); ImGui::TreePop(); }
+
+	// Widgets: Drags
+	bool sol_ImGui_DragFloat(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags)	{ return ImGui::DragFloat(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragFloat2(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags)	{ return ImGui::DragFloat2(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragFloat3(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags)	{ return ImGui::DragFloat3(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragFloat4(const char* label, float* v, float v_speed, float v_min, float v_max, const char* format, int flags)	{ return ImGui::DragFloat4(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragInt(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags)			{ return ImGui::DragInt(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragInt2(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags)			{ return ImGui::DragInt2(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragInt3(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags)			{ return ImGui::DragInt3(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_DragInt4(const char* label, int* v, float v_speed, int v_min, int v_max, const char* format, int flags)			{ return ImGui::DragInt4(label, v, v_speed, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+
+	// Widgets: Sliders
+	bool sol_ImGui_SliderFloat(const char* label, float* v, float v_min, float v_max, const char* format, int flags)								{ return ImGui::SliderFloat(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderFloat2(const char* label, float* v, float v_min, float v_max, const char* format, int flags)								{ return ImGui::SliderFloat2(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderFloat3(const char* label, float* v, float v_min, float v_max, const char* format, int flags)								{ return ImGui::SliderFloat3(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderFloat4(const char* label, float* v, float v_min, float v_max, const char* format, int flags)								{ return ImGui::SliderFloat4(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderAngle(const char* label, float* v_rad, float v_degrees_min, float v_degrees_max, const char* format, int flags)			{ return ImGui::SliderAngle(label, v_rad, v_degrees_min, v_degrees_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderInt(const char* label, int* v, int v_min, int v_max, const char* format, int flags)										{ return ImGui::SliderInt(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderInt2(const char* label, int* v, int v_min, int v_max, const char* format, int flags)									{ return ImGui::SliderInt2(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderInt3(const char* label, int* v, int v_min, int v_max, const char* format, int flags)									{ return ImGui::SliderInt3(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+	bool sol_ImGui_SliderInt4(const char* label, int* v, int v_min, int v_max, const char* format, int flags)									{ return ImGui::SliderInt4(label, v, v_min, v_max, format, static_cast<ImGuiSliderFlags>(flags)); }
+
+	// Item Utilities, Tooltips, Colors
+	bool sol_ImGui_IsItemHovered(int flags)																{ return ImGui::IsItemHovered(static_cast<ImGuiHoveredFlags>(flags)); }
+	bool sol_ImGui_IsItemClicked(int mouseButton)														{ return ImGui::IsItemClicked(static_cast<ImGuiMouseButton>(mouseButton)); }
+	void sol_ImGui_SetTooltip(const char* text)															{ ImGui::SetTooltip(text); }
+	unsigned int sol_ImGui_GetColorU32(float colR, float colG, float colB, float colA)					{ return ImGui::GetColorU32({ colR, colG, colB, colA }); }
+
+	// Draw Lists
+	ImDrawList* sol_ImGui_GetWindowDrawList(void)														{ return ImGui::GetWindowDrawList(); }
+	ImDrawList* sol_ImGui_GetBackgroundDrawList(void)													{ return ImGui::GetBackgroundDrawList(); }
+	ImDrawList* sol_ImGui_GetForegroundDrawList(void)													{ return ImGui::GetForegroundDrawList(); }
+	void sol_ImGui_DrawList_AddLine(ImDrawList* drawList, float x1, float y1, float x2, float y2, unsigned int col, float thickness)								{ drawList->AddLine({ x1, y1 }, { x2, y2 }, col, thickness); }
+	void sol_ImGui_DrawList_AddRect(ImDrawList* drawList, float x1, float y1, float x2, float y2, unsigned int col, float rounding, int flags, float thickness)	{ drawList->AddRect({ x1, y1 }, { x2, y2 }, col, rounding, static_cast<ImDrawFlags>(flags), thickness); }
+	void sol_ImGui_DrawList_AddRectFilled(ImDrawList* drawList, float x1, float y1, float x2, float y2, unsigned int col, float rounding, int flags)				{ drawList->AddRectFilled({ x1, y1 }, { x2, y2 }, col, rounding, static_cast<ImDrawFlags>(flags)); }
+	void sol_ImGui_DrawList_AddCircle(ImDrawList* drawList, float centerX, float centerY, float radius, unsigned int col, int segments, float thickness)			{ drawList->AddCircle({ centerX, centerY }, radius, col, segments, thickness); }
+	void sol_ImGui_DrawList_AddCircleFilled(ImDrawList* drawList, float centerX, float centerY, float radius, unsigned int col, int segments)					{ drawList->AddCircleFilled({ centerX, centerY }, radius, col, segments); }
+	void sol_ImGui_DrawList_AddTriangle(ImDrawList* drawList, float x1, float y1, float x2, float y2, float x3, float y3, unsigned int col, float thickness)		{ drawList->AddTriangle({ x1, y1 }, { x2, y2 }, { x3, y3 }, col, thickness); }
+	void sol_ImGui_DrawList_AddTriangleFilled(ImDrawList* drawList, float x1, float y1, float x2, float y2, float x3, float y3, unsigned int col)				{ drawList->AddTriangleFilled({ x1, y1 }, { x2, y2 }, { x3, y3 }, col); }
+	void sol_ImGui_DrawList_AddText(ImDrawList* drawList, float posX, float posY, unsigned int col, const char* text)											{ drawList->AddText({ posX, posY }, col, text); }
+	void sol_ImGui_DrawList_PathClear(ImDrawList* drawList)																										{ drawList->PathClear(); }
+	void sol_ImGui_DrawList_PathLineTo(ImDrawList* drawList, float posX, float posY)																			{ drawList->PathLineTo({ posX, posY }); }
+	void sol_ImGui_DrawList_PathStroke(ImDrawList* drawList, unsigned int col, int flags, float thickness)														{ drawList->PathStroke(col, static_cast<ImDrawFlags>(flags), thickness); }
+	void sol_ImGui_DrawList_PathFillConvex(ImDrawList* drawList, unsigned int col)																				{ drawList->PathFillConvex(col); }
+#endif
 }
+#endif
+#pragma endregion LuaJIT FFI
 
 #ifdef __clang__
 #pragma clang diagnostic pop
-#endif
\ No newline at end of file
+#endif